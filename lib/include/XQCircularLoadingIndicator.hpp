@@ -2,17 +2,39 @@
 #define XQCIRCULARLOADINGINDICATOR_HPP
 
 #include <QColor>
+#include <QDataStream>
 #include <QDebug>
+#include <QElapsedTimer>
 #include <QFont>
+#include <QFontMetricsF>
 #include <QFuture>
+#include <QFutureWatcher>
 #include <QGraphicsDropShadowEffect>
+#include <QGuiApplication>
+#include <QImage>
+#include <QHash>
 #include <QMap>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QPaintEvent>
 #include <QPainter>
+#include <QPixmap>
 #include <QResizeEvent>
+#include <QStaticText>
+#include <QTimer>
 #include <QWidget>
 #include <QtConcurrent/QtConcurrent>
+#include <atomic>
 #include <cmath>
+#include <memory>
+#include <utility>
+
+#include "XQCircularLoadingIndicatorClock.hpp"
+#include "XQCircularLoadingIndicatorDriver.hpp"
+#include "XQCircularLoadingIndicatorGroup.hpp"
+#include "XQCircularLoadingIndicatorPolicy.hpp"
+#include "XQCircularLoadingIndicatorStyles.hpp"
+#include "XQCircularLoadingIndicatorTrace.hpp"
 
 namespace xaprier {
 namespace Qt {
@@ -27,13 +49,33 @@ class XQCircularLoadingIndicator : public QWidget {
     Q_PROPERTY(int marginX MEMBER m_marginX READ GetMarginX WRITE SetMarginX NOTIFY si_MarginXChanged)
     Q_PROPERTY(int marginY MEMBER m_marginY READ GetMarginY WRITE SetMarginY NOTIFY si_MarginYChanged)
     Q_PROPERTY(int progressWidth MEMBER m_progressWidth READ GetProgressWidth WRITE SetProgressWidth NOTIFY si_ProgressWidthChanged)
+    Q_PROPERTY(int showDelay MEMBER m_showDelay READ GetShowDelay WRITE SetShowDelay NOTIFY si_ShowDelayChanged)
+    Q_PROPERTY(int minimumVisibleTime MEMBER m_minimumVisibleTime READ GetMinimumVisibleTime WRITE SetMinimumVisibleTime NOTIFY
+                   si_MinimumVisibleTimeChanged)
 
     Q_PROPERTY(bool square MEMBER m_square READ GetSquare WRITE SetSquare NOTIFY si_SquareChanged)
     Q_PROPERTY(bool shadow MEMBER m_shadow READ GetShadow WRITE SetShadow NOTIFY si_ShadowChanged)
     Q_PROPERTY(bool progressRoundedCap MEMBER m_progressRoundedCap READ GetProgressRoundedCap WRITE SetProgressRoundedCap NOTIFY
                    si_ProgressRoundedCapChanged)
+    Q_PROPERTY(bool tail MEMBER m_tail READ GetTail WRITE SetTail NOTIFY si_TailChanged)
     Q_PROPERTY(bool enableBg MEMBER m_enableBg READ GetEnableBg WRITE SetEnableBg NOTIFY si_EnableBgChanged)
     Q_PROPERTY(bool enableText MEMBER m_enableText READ GetEnableText WRITE SetEnableText NOTIFY si_EnableTextChanged)
+    Q_PROPERTY(bool textElide MEMBER m_textElide READ GetTextElide WRITE SetTextElide NOTIFY si_TextElideChanged)
+    Q_PROPERTY(bool textAutoFit MEMBER m_textAutoFit READ GetTextAutoFit WRITE SetTextAutoFit NOTIFY si_TextAutoFitChanged)
+
+    Q_PROPERTY(bool lowDamage MEMBER m_lowDamage READ GetLowDamage WRITE SetLowDamage NOTIFY si_LowDamageChanged)
+    Q_PROPERTY(int lowDamageStep MEMBER m_lowDamageStep READ GetLowDamageStep WRITE SetLowDamageStep NOTIFY si_LowDamageStepChanged)
+    Q_PROPERTY(bool lowDamageAntialiasing MEMBER m_lowDamageAntialiasing READ GetLowDamageAntialiasing WRITE SetLowDamageAntialiasing NOTIFY
+                   si_LowDamageAntialiasingChanged)
+
+    Q_PROPERTY(bool threadedRendering MEMBER m_threadedRendering READ GetThreadedRendering WRITE SetThreadedRendering NOTIFY
+                   si_ThreadedRenderingChanged)
+
+    Q_PROPERTY(int smallDetailSize MEMBER m_smallDetailSize READ GetSmallDetailSize WRITE SetSmallDetailSize NOTIFY si_SmallDetailSizeChanged)
+    Q_PROPERTY(int tinyDetailSize MEMBER m_tinyDetailSize READ GetTinyDetailSize WRITE SetTinyDetailSize NOTIFY si_TinyDetailSizeChanged)
+    Q_PROPERTY(Detail detail READ GetDetail NOTIFY si_DetailChanged)
+
+    Q_PROPERTY(Style style MEMBER m_style READ GetStyle WRITE SetStyle NOTIFY si_StyleChanged)
 
     Q_PROPERTY(::Qt::Alignment progressAlignment MEMBER m_progressAlignment READ GetProgressAlignment WRITE SetProgressAlignment NOTIFY
                    si_ProgressAlignmentChanged)
@@ -44,7 +86,32 @@ class XQCircularLoadingIndicator : public QWidget {
 
     Q_PROPERTY(QString text MEMBER m_text READ GetText WRITE SetText NOTIFY si_TextChanged)
 
+    Q_PROPERTY(qint64 cacheLimit MEMBER m_cacheLimit READ GetCacheLimit WRITE SetCacheLimit NOTIFY si_CacheLimitChanged)
+
+    Q_PROPERTY(int progressValue READ GetProgressValue WRITE SetProgressValue NOTIFY si_ProgressValueChanged)
+
   public:
+    /**
+     * @brief Visual style of the moving part, see XQCircularLoadingIndicatorStyles.hpp
+     */
+    enum class Style {
+        Arc,      //> single arc segment
+        DualArc,  //> two counter-rotating arcs
+        Dots,     //> ring of dots with a fading trail
+        Bars,     //> radial bars with a fading trail
+    };
+    Q_ENUM(Style)
+
+    /**
+     * @brief Level of detail, chosen from the rendered size in device pixels
+     */
+    enum class Detail {
+        Full,   //> every phase, full tick rate, configured caps
+        Small,  //> 36 phases, 30 fps, flat caps
+        Tiny,   //> 12 phases, 15 fps, flat caps, frames pre-rasterized into a sprite
+    };
+    Q_ENUM(Detail)
+
     /**
      * @brief Construct a new Circular Progress object
      *
@@ -54,15 +121,52 @@ class XQCircularLoadingIndicator : public QWidget {
     ~XQCircularLoadingIndicator();
 
     /**
-     * @brief Starts the thread for animate loading
+     * @brief Starts the thread for animate loading. If the show delay is
+     * positive nothing is spawned or painted until the delay has elapsed, so an
+     * operation stopped within the delay costs only a timer.
+     *
+     * @param delay Show delay in milliseconds, negative uses the showDelay property
      */
-    void Start();
+    void Start(const int &delay = -1);
 
     /**
-     * @brief Stops the thread for animation of loading
+     * @brief Stops the thread for animation of loading. Once the animation is
+     * visible it is kept for at least minimumVisibleTime to avoid flicker.
+     * Returns without waiting for the animation thread, si_Stopped is emitted
+     * once it has let go of the indicator.
      */
     void Stop();
 
+    /**
+     * @brief Binds the indicator to a future: it starts while the future runs,
+     * stops when it finishes or is canceled and switches to determinate display
+     * when the future reports a progress range. Any number of futures can be
+     * tracked, the indicator stops once the last one is done.
+     *
+     * @param future Future to track, typically from QtConcurrent
+     */
+    template <typename T>
+    void Track(const QFuture<T> &future) {
+        auto *watcher = new QFutureWatcher<T>(this);
+        connect(watcher, &QFutureWatcherBase::finished, watcher, &QObject::deleteLater);
+        Track(watcher);
+        watcher->setFuture(future);
+    }
+
+    /**
+     * @brief Same as Track(QFuture) for a watcher owned by the caller
+     *
+     * @param watcher Watcher to track, untracked automatically when destroyed
+     */
+    void Track(QFutureWatcherBase *watcher);
+
+    /**
+     * @brief Stops tracking a watcher passed to Track()
+     *
+     * @param watcher Tracked watcher
+     */
+    void Untrack(QFutureWatcherBase *watcher);
+
     ///< SETTERS
     void SetMaximumSpeed(const double &speed = 3.0);
     void SetMinimumSpeed(const double &speed = 1.0);
@@ -74,12 +178,47 @@ class XQCircularLoadingIndicator : public QWidget {
     void SetMarginX(const int &x = 0);
     void SetMarginY(const int &y = 0);
     void SetProgressWidth(const int &width = 10);
+    void SetShowDelay(const int &delay = 0);
+    void SetMinimumVisibleTime(const int &time = 0);
 
     void SetSquare(const bool &enable = false);
     void SetShadow(const bool &enable = true);
     void SetProgressRoundedCap(const bool &enable = true);
+    void SetTail(const bool &enable = false);
     void SetEnableBg(const bool &enable = true);
     void SetEnableText(const bool &enable = false);
+    void SetTextElide(const bool &enable = true);
+    void SetTextAutoFit(const bool &enable = true);
+
+    void SetStyle(const Style &style = Style::Arc);
+
+    /**
+     * @brief Low-damage mode for remote sessions (VNC, RDP, X11 forwarding):
+     * ticks at most 20 times a second, moves in discrete angular steps, only
+     * repaints the pixels of the old and new segment and, unless
+     * lowDamageAntialiasing is set, draws without antialiasing. Enabled by
+     * default when IsRemoteSession() detects a remote session.
+     */
+    void SetLowDamage(const bool &enable = false);
+    void SetLowDamageStep(const int &degrees = 15);
+    void SetLowDamageAntialiasing(const bool &enable = false);
+
+    /**
+     * @brief Rasterizes the frames on the animation thread into a triple
+     * buffer of images; paintEvent only blits the latest completed one. Falls
+     * back to painting on the GUI thread for determinate progress, the Tiny
+     * detail, uncached rendering and while a resize settles.
+     */
+    void SetThreadedRendering(const bool &enable = false);
+
+    /**
+     * @brief Level-of-detail thresholds: an indicator whose smaller side is
+     * below the size in device pixels renders with the Small or Tiny detail
+     *
+     * @param pixels Threshold in device pixels, 0 disables the tier
+     */
+    void SetSmallDetailSize(const int &pixels = 32);
+    void SetTinyDetailSize(const int &pixels = 20);
 
     void SetProgressAlignment(const ::Qt::Alignment &alignment = ::Qt::AlignCenter);
 
@@ -89,6 +228,39 @@ class XQCircularLoadingIndicator : public QWidget {
 
     void SetText(const QString &text = "Loading...");
 
+    /**
+     * @brief Determinate display like QProgressBar: a range with minimum equal
+     * to maximum (the default) shows the spinning segment, otherwise the arc
+     * shows the value within the range. Both can be changed while running.
+     */
+    void SetProgressRange(const int &minimum = 0, const int &maximum = 0);
+    void SetProgressValue(const int &value = 0);
+
+    /**
+     * @brief Replaces the time source of the animation thread, e.g. with a
+     * XQCircularLoadingIndicatorManualClock in tests. The clock is not owned.
+     *
+     * @param clock Clock to use, nullptr restores the system clock
+     */
+    void SetClock(XQCircularLoadingIndicatorClock *clock = nullptr);
+
+    /**
+     * @brief Moves a stopped indicator to a fixed phase, e.g. to render it
+     * offscreen with QWidget::grab() for image comparisons
+     *
+     * @param value Phase in degrees, as returned by GetCurrentValue()
+     */
+    void SetCurrentValue(const double &value = 0);
+
+    /**
+     * @brief Caps the bytes this indicator may hold in offscreen caches. Above
+     * the cap, or above the global cap for all indicators, it renders uncached.
+     *
+     * @param bytes Limit in bytes, 0 for no limit
+     */
+    void SetCacheLimit(const qint64 &bytes = 0);
+    static void SetGlobalCacheLimit(const qint64 &bytes = 0);
+
     ///< GETTERS
     double GetMaximumSpeed() const { return m_maxSpeed; }
     double GetMinimumSpeed() const { return m_minSpeed; }
@@ -98,15 +270,44 @@ class XQCircularLoadingIndicator : public QWidget {
     int GetMarginX() const { return m_marginX; }
     int GetMarginY() const { return m_marginY; }
     int GetProgressWidth() const { return m_progressWidth; }
+    int GetShowDelay() const { return m_showDelay; }
+    int GetMinimumVisibleTime() const { return m_minimumVisibleTime; }
 
     bool GetSquare() const { return m_square; }
     bool GetShadow() const { return m_shadow; }
     bool GetProgressRoundedCap() const { return m_progressRoundedCap; }
+    bool GetTail() const { return m_tail; }
     bool GetEnableBg() const { return m_enableBg; }
     bool GetEnableText() const { return m_enableText; }
+    bool GetTextElide() const { return m_textElide; }
+    bool GetTextAutoFit() const { return m_textAutoFit; }
 
     bool GetRunning() const { return m_running; }
 
+    Style GetStyle() const { return m_style; }
+
+    bool GetLowDamage() const { return m_lowDamage; }
+    int GetLowDamageStep() const { return m_lowDamageStep; }
+    bool GetLowDamageAntialiasing() const { return m_lowDamageAntialiasing; }
+
+    bool GetThreadedRendering() const { return m_threadedRendering; }
+
+    int GetSmallDetailSize() const { return m_smallDetailSize; }
+    int GetTinyDetailSize() const { return m_tinyDetailSize; }
+    Detail GetDetail() const { return m_detail.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Bytes of widget area repainted so far (device pixels, 4 bytes
+     * each), sample it periodically to compare the damage rate of the modes
+     */
+    qint64 GetDamagedBytes() const { return m_damagedBytes; }
+
+    /**
+     * @brief Whether the application is displayed through a remote session,
+     * detected once from the platform
+     */
+    static bool IsRemoteSession();
+
     ::Qt::Alignment GetProgressAlignment() const { return m_progressAlignment; }
 
     QColor GetBgColor() const { return m_bgColor; }
@@ -115,7 +316,39 @@ class XQCircularLoadingIndicator : public QWidget {
 
     QString GetText() const { return m_text; }
 
+    int GetProgressMinimum() const { return m_progressMinimum; }
+    int GetProgressMaximum() const { return m_progressMaximum; }
+    int GetProgressValue() const { return m_progressValue; }
+    bool GetDeterminate() const { return m_determinate; }
+
+    XQCircularLoadingIndicatorClock *GetClock() const { return m_clock; }
+    double GetCurrentValue() const { return m_currentValue.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Phase-locked group the indicator belongs to, see
+     * XQCircularLoadingIndicatorGroup::AddIndicator()
+     */
+    XQCircularLoadingIndicatorGroup *GetGroup() const { return m_group; }
+
+    /**
+     * @brief Bytes held by this indicator's caches and buffers (static layer,
+     * style textures and geometry, label layout, shadow buffer) and the device
+     * pixel ratio they were allocated for
+     */
+    qint64 GetCacheBytes() const { return m_cacheBytes; }
+    qreal GetCacheDevicePixelRatio() const { return m_layerLayout.devicePixelRatio; }
+    qint64 GetCacheLimit() const { return m_cacheLimit; }
+    bool GetCached() const { return m_cached; }
+
+    /**
+     * @brief Bytes held by the caches of all indicators in the process
+     */
+    static qint64 GetTotalCacheBytes() { return totalCacheBytes.load(std::memory_order_relaxed); }
+    static qint64 GetGlobalCacheLimit() { return globalCacheLimit.load(std::memory_order_relaxed); }
+
   signals:
+    void si_Stopped();
+
     void si_MaximumSpeedChanged(double speed);
     void si_MinimumSpeedChanged(double speed);
     void si_SegmentChanged(int segmentSize);
@@ -125,12 +358,29 @@ class XQCircularLoadingIndicator : public QWidget {
     void si_MarginXChanged(int x);
     void si_MarginYChanged(int y);
     void si_ProgressWidthChanged(int width);
+    void si_ShowDelayChanged(int delay);
+    void si_MinimumVisibleTimeChanged(int time);
 
     void si_SquareChanged(bool enable);
     void si_ShadowChanged(bool enable);
     void si_ProgressRoundedCapChanged(bool enable);
+    void si_TailChanged(bool enable);
     void si_EnableBgChanged(bool enable);
     void si_EnableTextChanged(bool enable);
+    void si_TextElideChanged(bool enable);
+    void si_TextAutoFitChanged(bool enable);
+
+    void si_StyleChanged(Style style);
+
+    void si_LowDamageChanged(bool enable);
+    void si_LowDamageStepChanged(int degrees);
+    void si_LowDamageAntialiasingChanged(bool enable);
+
+    void si_ThreadedRenderingChanged(bool enable);
+
+    void si_SmallDetailSizeChanged(int pixels);
+    void si_TinyDetailSizeChanged(int pixels);
+    void si_DetailChanged(Detail detail);
 
     void si_ProgressAlignmentChanged(::Qt::Alignment alignment);
 
@@ -140,11 +390,185 @@ class XQCircularLoadingIndicator : public QWidget {
 
     void si_TextChanged(QString text);
 
+    void si_CacheLimitChanged(qint64 bytes);
+
+    void si_ProgressRangeChanged(int minimum, int maximum);
+    void si_ProgressValueChanged(int value);
+
   protected:
     /**
      * @brief The thread's function for progressing the loading animation
+     *
+     * @param ticks Elapsed time in units of the base tick interval, so the
+     * animation keeps its speed when the policy throttles the tick rate. Long
+     * intervals are integrated in whole ticks, so the phase only depends on the
+     * elapsed time and not on how it was sliced.
+     */
+    void _Progress(const double &ticks = 1.0);
+
+    /**
+     * @brief Advances a phase by the given number of base ticks, faster on the
+     * lower half of the circle
+     */
+    static double _Integrate(const double &value, const double &ticks, const double &minSpeed, const double &maxSpeed);
+
+    /**
+     * @brief Called by XQCircularLoadingIndicatorGroup. Joining keeps the
+     * current phase as an offset to the group phase that decays over a few
+     * ticks, leaving keeps the current phase.
+     */
+    void _JoinGroup(XQCircularLoadingIndicatorGroup *group);
+    void _LeaveGroup();
+
+    /**
+     * @brief Serializes everything that affects the painted pixels, members of
+     * a group with equal keys share their frames
      */
-    void _Progress();
+    void _UpdateFrameKey();
+
+    /**
+     * @brief Spawns the animation thread once the show delay has elapsed
+     */
+    void _Launch();
+
+    /**
+     * @brief Signals the animation thread to exit, ignoring the minimum
+     * visible time
+     */
+    void _Finish();
+
+    /**
+     * @brief Recomputes the ref-count and the aggregated progress of the
+     * tracked futures, starting or stopping the indicator accordingly
+     */
+    void _UpdateTracked();
+
+    /**
+     * @brief Derives width, height and margins from the widget size and the
+     * square/alignment properties
+     *
+     * @param size Widget size
+     */
+    void _UpdateGeometry(const QSize &size);
+
+    /**
+     * @brief Computes the cached paint geometry from width, height, margins and
+     * progress width
+     */
+    void _UpdateLayout();
+
+    /**
+     * @brief Precomputes the geometry of the current style (dot positions, bar
+     * angles, pens, gradients) for the current layout and colors. Cheap enough
+     * for every resize step, it never rasterizes.
+     */
+    void _PrepareStyle();
+    Styles::Params _StyleParams() const;
+
+    /**
+     * @brief Rasterizes the style's offscreen textures for the prepared
+     * geometry. Only called from _RebuildCaches(), until then the style draws
+     * from its gradients.
+     */
+    void _PrepareTextures();
+
+    /**
+     * @brief Draws the static and the moving part with the given style policy.
+     * Instantiated once per style so the per-primitive loops are specialized.
+     */
+    template <typename S>
+    void _DrawBackground(QPainter &painter, const typename S::Geometry &geometry);
+    template <typename S>
+    void _DrawProgress(QPainter &painter, const typename S::Geometry &geometry, const double &value, const bool &determinate);
+
+    /**
+     * @brief Dispatches _DrawProgress() to the current style
+     *
+     * @param value Phase to draw, already quantized
+     * @param determinate Fill the progress range instead of drawing the trail
+     */
+    void _DrawMoving(QPainter &painter, const double &value, const bool &determinate);
+
+    /**
+     * @brief Draws the background and the label directly, used to fill the
+     * static layer and when rendering uncached
+     */
+    void _DrawStatic(QPainter &painter);
+
+    /**
+     * @brief Draws the static layer and the moving part at the given phase
+     * within rect
+     */
+    void _PaintFrame(QPainter &painter, const QRect &rect, const double &value);
+
+    /**
+     * @brief Blits the group's shared frame for the group's latest tick,
+     * rendering it first if no member did. Returns false when the frame can't
+     * be shared (no group, not animating, determinate, low-damage, still
+     * easing into the group phase or no other member with the same
+     * configuration).
+     */
+    bool _PaintShared(QPainter &painter, const QRect &rect);
+
+    /**
+     * @brief Blits the latest frame rendered by the animation thread. Returns
+     * false when there is none for the current configuration.
+     */
+    bool _PaintRendered(QPainter &painter, const QRect &rect);
+
+    /**
+     * @brief Hands the current configuration to the animation thread for
+     * threaded rendering, or withdraws it when frames can't be rendered there
+     */
+    void _PublishSnapshot();
+
+    /**
+     * @brief Whether frames are drawn antialiased, see the policy's render
+     * tier and lowDamageAntialiasing
+     */
+    bool _Antialiasing() const;
+
+    /**
+     * @brief Phase as drawn, rounded down to the low-damage or level-of-detail
+     * step when one applies
+     */
+    double _Quantize(const double &value) const;
+
+    /**
+     * @brief Animation tick interval in ms: the policy's, stretched by
+     * low-damage mode and the level of detail. Called by the animation thread.
+     */
+    int _TickInterval() const;
+
+    /**
+     * @brief Widget area covered by the moving part at the given phase
+     */
+    QRect _DirtyRect(const double &value) const;
+
+    /**
+     * @brief Bytes the caches would take for the current configuration, and
+     * whether they fit the per-instance and global limits
+     */
+    qint64 _EstimateCacheBytes() const;
+    bool _CacheFits(const qint64 &bytes) const;
+
+    /**
+     * @brief Recounts the bytes held and updates the process total
+     */
+    void _AccountCaches();
+
+    /**
+     * @brief Rebuilds every size dependent cache: the label layout, the style
+     * textures and the static layer holding the background ring and the label
+     */
+    void _RebuildCaches();
+
+    /**
+     * @brief Lays out the label once into m_staticText, fitting and eliding it
+     * to the inner diameter. Called on text, font and size changes only, never
+     * from paintEvent.
+     */
+    void _PrepareText();
 
     /**
      * @brief Qt's overrided functions for painting the widget and resizing the
@@ -152,13 +576,41 @@ class XQCircularLoadingIndicator : public QWidget {
      */
     void paintEvent(QPaintEvent *event) override;
     void resizeEvent(QResizeEvent *event) override;
+    void changeEvent(QEvent *event) override;
 
   private:
+    friend class XQCircularLoadingIndicatorGroup;
+
+    /**
+     * @brief Paint geometry, computed once per size or property change instead
+     * of on every paint
+     */
+    struct Layout {
+        QRect frame;                  //> area the indicator occupies
+        QRectF arc;                   //> bounding rect of the arc, snapped to the device pixel grid
+        qreal penWidth = 0;           //> progress width rounded to whole device pixels
+        qreal devicePixelRatio = 1;   //> ratio the layout and caches were built for
+    };
+
+    static constexpr int ResizeSettleInterval = 120;  //> ms without resize before caches are rebuilt
+
     const int m_circularDegree = 360;
-    QFuture<void> m_future;
+    /**
+     * @brief Shared with the driver task, which only reaches the indicator
+     * through it. The destructor clears the owner instead of waiting for it.
+     */
+    struct Guard {
+        QMutex mutex;
+        XQCircularLoadingIndicator *owner = nullptr;
+    };
+    std::shared_ptr<Guard> m_guard = std::make_shared<Guard>();
+    std::shared_ptr<std::atomic<bool>> m_animation;  //> run flag of the current driver task, one per launch
+    XQCircularLoadingIndicatorPolicy *m_policy = nullptr;
+    XQCircularLoadingIndicatorClock *m_clock = XQCircularLoadingIndicatorClock::System();
     double m_maxSpeed = 3.0, m_minSpeed = 1.0;
     bool m_running = false;
-    double m_currentValue = 0;
+    bool m_animating = false;  //> worker spawned, false while the show delay is pending
+    std::atomic<double> m_currentValue{0};  //> written by the animation thread only
     int m_segmentSize = 12;
     QWidget *m_superClass = nullptr;
     int m_width = 200;
@@ -166,16 +618,123 @@ class XQCircularLoadingIndicator : public QWidget {
     int m_marginX = 0;
     int m_marginY = 0;
     int m_progressWidth = 10;
+    int m_showDelay = 0;           //> ms before a started indicator begins animating
+    int m_minimumVisibleTime = 0;  //> ms a visible animation is kept after Stop()
+    QTimer m_showTimer;
+    QTimer m_stopTimer;
+    QElapsedTimer m_visibleClock;
     bool m_square = false;  //> square progress bar
     bool m_shadow = false;
     bool m_progressRoundedCap = true;
+    bool m_tail = false;  //> comet tail on the arc styles
     bool m_enableBg = true;
     bool m_enableText = false;
+    bool m_textElide = true;     //> elide the label when it does not fit the inner diameter
+    bool m_textAutoFit = true;   //> shrink the label font to fit the inner diameter
+    Style m_style = Style::Arc;
+    bool m_lowDamage = false;
+    int m_lowDamageStep = 15;  //> degrees
+    bool m_lowDamageAntialiasing = false;
+    qint64 m_damagedBytes = 0;
+    static constexpr int LowDamageTickInterval = 50;  //> ms
+    int m_smallDetailSize = 32;  //> device pixels
+    int m_tinyDetailSize = 20;   //> device pixels
+    std::atomic<Detail> m_detail{Detail::Full};  //> changes on resize, read by the animation thread
+    static constexpr int SmallDetailStep = 10;          //> degrees
+    static constexpr int SmallDetailTickInterval = 33;  //> ms
+    static constexpr int TinyDetailStep = 30;           //> degrees, divides 360 so the sprite holds every phase
+    static constexpr int TinyDetailTickInterval = 66;   //> ms
+    QPixmap m_sprite;  //> Tiny detail only, every phase side by side including the static layer
+    XQCircularLoadingIndicatorGroup *m_group = nullptr;  //> changed under the guard, read by the animation thread
+    std::atomic<double> m_groupOffset{0};               //> degrees ahead of the group phase, decays after joining
+    QByteArray m_frameKey;                              //> see _UpdateFrameKey(), empty outside a group
+    static constexpr double GroupCatchUp = 0.9;         //> offset kept per base tick
+    static constexpr double GroupSnap = 0.5;            //> degrees, smaller offsets are dropped
     ::Qt::Alignment m_progressAlignment = ::Qt::AlignCenter;
     QColor m_bgColor = "#44475a";
     QColor m_progressColor = "#498BD1";
     QColor m_textColor = "#498BD1";
     QString m_text = "Loading...";
+    int m_progressMinimum = 0;
+    int m_progressMaximum = 0;
+    int m_progressValue = 0;
+    std::atomic<bool> m_determinate{false};  //> read by the animation thread
+
+    struct TrackedFuture {
+        bool started = false;
+        int minimum = 0;
+        int maximum = 0;
+        int value = 0;
+    };
+    QHash<QFutureWatcherBase *, TrackedFuture> m_tracked;
+    bool m_trackedStart = false;  //> the indicator was started by Track(), not by the user
+    bool m_trackedRange = false;  //> the determinate range was set by Track(), reset once stopped
+    QStaticText m_staticText;  //> cached label layout, see _PrepareText()
+    QFont m_textFont;
+    QPointF m_textPos;
+    Layout m_layout;
+    Layout m_layerLayout;  //> layout m_layer was rendered for
+    QPixmap m_layer;       //> background ring and label
+
+    /**
+     * @brief Precomputed geometry per style, only the current style's is kept
+     * up to date
+     */
+    struct StyleGeometry {
+        Styles::Arc::Geometry arc;
+        Styles::DualArc::Geometry dualArc;
+        Styles::Dots::Geometry dots;
+        Styles::Bars::Geometry bars;
+    } m_styleGeometry;
+
+    /**
+     * @brief Everything the animation thread needs to render a frame, copied on
+     * the GUI thread so rendering never reads the widget. Qt's implicit sharing
+     * keeps the copy cheap.
+     */
+    struct Snapshot {
+        quint64 generation = 0;
+        QSize size;
+        qreal devicePixelRatio = 1;
+        Style style = Style::Arc;
+        StyleGeometry geometry;
+        QImage layer;  //> QPixmap is GUI thread only
+        int segmentSize = 12;
+        bool antialiasing = true;
+    };
+
+    /**
+     * @brief Triple buffer between the animation thread and paintEvent: each
+     * side owns one image, the third is exchanged through an atomic index, so
+     * neither side ever waits for the other
+     */
+    struct Buffers {
+        QImage images[3];
+        quint64 generations[3] = {0, 0, 0};  //> snapshot each image was rendered from
+        std::atomic<int> middle{1};          //> index of the exchanged image, FreshFrame when it is newer than front
+        int back = 2;                        //> animation thread only
+        int front = 0;                       //> GUI thread only
+    };
+    static constexpr int FreshFrame = 4;
+
+    /**
+     * @brief Renders a frame into the back buffer and publishes it, called by
+     * the animation thread outside the guard. Its duration is reported to the
+     * policy like a paint.
+     */
+    static void _Render(Buffers &buffers, const Snapshot &snapshot, const double &value, const void *object);
+
+    bool m_threadedRendering = false;
+    std::shared_ptr<const Snapshot> m_snapshot;  //> replaced under the guard, nullptr when not rendering threaded
+    quint64 m_snapshotGeneration = 0;
+    std::shared_ptr<Buffers> m_buffers = std::make_shared<Buffers>();  //> replaced under the guard on every launch
+    QImage m_layerImage;  //> copy of m_layer for the animation thread
+    QTimer m_resizeTimer;
+    bool m_cached = true;       //> false while over a cache limit, everything is drawn directly
+    qint64 m_cacheLimit = 0;    //> bytes, 0 for no limit
+    qint64 m_cacheBytes = 0;    //> accounted in totalCacheBytes
+    static std::atomic<qint64> totalCacheBytes;
+    static std::atomic<qint64> globalCacheLimit;
 };
 
 }  // namespace Widgets
@@ -0,0 +1,137 @@
+#ifndef XQCIRCULARLOADINGINDICATORCLOCK_HPP
+#define XQCIRCULARLOADINGINDICATORCLOCK_HPP
+
+#include <QDeadlineTimer>
+#include <QElapsedTimer>
+#include <QMultiMap>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QWaitCondition>
+#include <iterator>
+
+namespace xaprier {
+namespace Qt {
+namespace Widgets {
+/**
+ * @brief Time source of the animation threads. The indicator only asks the
+ * clock for the current time and to sleep between ticks, so tests can inject
+ * a manual clock and advance virtual time explicitly. Every running indicator
+ * on a clock is ticked by the same thread, see
+ * XQCircularLoadingIndicatorDriver.
+ *
+ * Stop() and the indicator's destructor return before the animation thread
+ * has let go of the clock, so a clock must not be destroyed while threads are
+ * attached: implementations call WaitDetached() first thing in their
+ * destructor, as the provided clocks do.
+ */
+class XQCircularLoadingIndicatorClock {
+  public:
+    virtual ~XQCircularLoadingIndicatorClock() = default;
+
+    /**
+     * @brief Returns the process-wide real time clock used by default
+     */
+    static XQCircularLoadingIndicatorClock *System();
+
+    /**
+     * @brief Monotonic time in milliseconds
+     */
+    virtual qint64 Elapsed() const = 0;
+
+    /**
+     * @brief Blocks the calling animation thread for the given time or until
+     * Wake() is called
+     *
+     * @param ms Time to sleep in milliseconds
+     */
+    virtual void Sleep(const int &ms) = 0;
+
+    /**
+     * @brief Wakes the sleeping animation thread early, used by Stop() and
+     * when an indicator starts. A Wake() while nothing sleeps must cut the
+     * next Sleep() short instead of being lost, the thread may be just about
+     * to sleep after checking its tasks.
+     */
+    virtual void Wake() = 0;
+
+    /**
+     * @brief Called on the GUI thread before an animation thread starts using
+     * the clock, and by that thread once it stops using it. Overrides must call
+     * the base implementation, Detach() as their very last access to the clock.
+     */
+    virtual void Attach();
+    virtual void Detach();
+
+    /**
+     * @brief Blocks until every animation thread has detached
+     */
+    void WaitDetached();
+
+  private:
+    QMutex m_attachMutex;
+    QWaitCondition m_detached;
+    int m_attachedThreads = 0;
+};
+
+/**
+ * @brief Real time clock, sleeps on a wait condition so Wake() can interrupt
+ * the sleep instead of waiting for it to run out
+ */
+class XQCircularLoadingIndicatorSystemClock : public XQCircularLoadingIndicatorClock {
+  public:
+    XQCircularLoadingIndicatorSystemClock();
+    ~XQCircularLoadingIndicatorSystemClock();
+
+    qint64 Elapsed() const override { return m_timer.elapsed(); }
+    void Sleep(const int &ms) override;
+    void Wake() override;
+
+  private:
+    QElapsedTimer m_timer;
+    QMutex m_mutex;
+    QWaitCondition m_condition;
+    quint64 m_wakeups = 0;
+    quint64 m_seenWakeups = 0;  //> wakeups already consumed by a Sleep()
+};
+
+/**
+ * @brief Virtual clock for tests. Time only moves on Advance(), which returns
+ * once every attached animation thread has processed the new time and is
+ * sleeping again, so phase checks after Advance() are deterministic.
+ */
+class XQCircularLoadingIndicatorManualClock : public XQCircularLoadingIndicatorClock {
+  public:
+    ~XQCircularLoadingIndicatorManualClock();
+
+    /**
+     * @brief Moves virtual time forward and waits for the animation threads to
+     * catch up
+     *
+     * @param ms Time to advance in milliseconds
+     */
+    void Advance(const qint64 &ms);
+
+    qint64 Elapsed() const override;
+    void Sleep(const int &ms) override;
+    void Wake() override;
+    void Attach() override;
+    void Detach() override;
+
+  private:
+    bool _Settled() const;
+
+    mutable QMutex m_mutex;
+    QWaitCondition m_tick;     //> signalled on Advance() and Wake()
+    QWaitCondition m_settled;  //> signalled when a thread parks or detaches
+    qint64 m_now = 0;
+    quint64 m_wakeups = 0;
+    quint64 m_seenWakeups = 0;  //> wakeups already consumed by a Sleep()
+    int m_attached = 0;
+    QMultiMap<qint64, int> m_sleepers;  //> deadline of every parked thread
+};
+
+}  // namespace Widgets
+}  // namespace Qt
+}  // namespace xaprier
+
+#endif  // XQCIRCULARLOADINGINDICATORCLOCK_HPP
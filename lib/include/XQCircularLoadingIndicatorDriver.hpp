@@ -0,0 +1,85 @@
+#ifndef XQCIRCULARLOADINGINDICATORDRIVER_HPP
+#define XQCIRCULARLOADINGINDICATORDRIVER_HPP
+
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QMutexLocker>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include "XQCircularLoadingIndicatorClock.hpp"
+#include "XQCircularLoadingIndicatorPolicy.hpp"
+
+namespace xaprier {
+namespace Qt {
+namespace Widgets {
+/**
+ * @brief One animation thread per clock, ticking every running indicator on
+ * that clock. Each indicator adds a task when it starts animating; the driver
+ * wakes for the earliest due task, ticks every due task and sleeps again. The
+ * thread starts with the first task and exits once the last one is dropped,
+ * so any number of indicators animate on a single thread, independent of the
+ * global thread pool.
+ */
+class XQCircularLoadingIndicatorDriver {
+  public:
+    /**
+     * @brief Runs one tick of a task at the given clock time and returns the
+     * ms until its next tick, or a negative value to drop the task
+     */
+    using Tick = std::function<int(const qint64 &now)>;
+
+    /**
+     * @brief Adds a task to the driver of the clock, starting the driver if
+     * the clock has none. Called on the GUI thread.
+     *
+     * @param clock Clock the task ticks on, attached while the driver runs
+     * @param running Cleared to stop the task, followed by Wake() on the clock
+     * @param tick Called on the driver thread once per tick
+     * @param finished Called on the driver thread once the task was dropped
+     */
+    static void Add(XQCircularLoadingIndicatorClock *clock, const std::shared_ptr<std::atomic<bool>> &running, const Tick &tick,
+                    const std::function<void()> &finished);
+
+    //* Delete copy constructor and assignment operator
+    XQCircularLoadingIndicatorDriver(const XQCircularLoadingIndicatorDriver &) = delete;
+    XQCircularLoadingIndicatorDriver &operator=(const XQCircularLoadingIndicatorDriver &) = delete;
+
+  private:
+    struct Task {
+        std::shared_ptr<std::atomic<bool>> running;
+        Tick tick;
+        std::function<void()> finished;
+        qint64 due = 0;  //> clock time of the next tick
+    };
+
+    explicit XQCircularLoadingIndicatorDriver(XQCircularLoadingIndicatorClock *clock) : m_clock(clock) {}
+
+    /**
+     * @brief Thread body, deletes the driver when the last task is gone
+     */
+    void _Run();
+
+    XQCircularLoadingIndicatorClock *m_clock;
+    QList<std::shared_ptr<Task>> m_tasks;  //> guarded by _Mutex()
+
+    /**
+     * @brief Guards the registry and every driver's tasks. Never destroyed,
+     * detached driver threads still winding down at exit lock it.
+     */
+    static QMutex &_Mutex();
+
+    /**
+     * @brief Running driver per clock, never destroyed like _Mutex()
+     */
+    static QHash<XQCircularLoadingIndicatorClock *, XQCircularLoadingIndicatorDriver *> &_Drivers();
+};
+
+}  // namespace Widgets
+}  // namespace Qt
+}  // namespace xaprier
+
+#endif  // XQCIRCULARLOADINGINDICATORDRIVER_HPP
@@ -0,0 +1,132 @@
+#ifndef XQCIRCULARLOADINGINDICATORGROUP_HPP
+#define XQCIRCULARLOADINGINDICATORGROUP_HPP
+
+#include <QByteArray>
+#include <QDebug>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QObject>
+#include <QPixmap>
+
+namespace xaprier {
+namespace Qt {
+namespace Widgets {
+class XQCircularLoadingIndicator;
+
+/**
+ * @brief Phase-locked set of indicators. Members animate with one shared
+ * phase, and members with an identical visual configuration share one frame
+ * per base tick of the group: the first member to paint renders the group
+ * phase of that tick, the others only blit it, whichever of their own ticks
+ * requested the repaint.
+ * Indicators can join and leave while running; a joining indicator eases into
+ * the group phase and a leaving one continues from where it is.
+ */
+class XQCircularLoadingIndicatorGroup : public QObject {
+    Q_OBJECT
+    Q_PROPERTY(int count READ GetCount NOTIFY si_CountChanged)
+
+  public:
+    explicit XQCircularLoadingIndicatorGroup(QObject *parent = nullptr);
+    ~XQCircularLoadingIndicatorGroup();
+
+    //* Delete copy constructor and assignment operator
+    XQCircularLoadingIndicatorGroup(const XQCircularLoadingIndicatorGroup &) = delete;
+    XQCircularLoadingIndicatorGroup &operator=(const XQCircularLoadingIndicatorGroup &) = delete;
+
+    /**
+     * @brief Adds an indicator, removing it from its previous group. The first
+     * member defines the group phase.
+     *
+     * @param indicator Indicator to add, not owned
+     */
+    void AddIndicator(XQCircularLoadingIndicator *indicator);
+
+    /**
+     * @brief Removes an indicator, it keeps animating from its current phase
+     *
+     * @param indicator Member to remove
+     */
+    void RemoveIndicator(XQCircularLoadingIndicator *indicator);
+
+    ///< GETTERS
+    QList<XQCircularLoadingIndicator *> GetIndicators() const { return m_indicators; }
+    int GetCount() const { return m_indicators.size(); }
+    double GetCurrentValue() const;
+
+    /**
+     * @brief Bytes held by the shared frames, also accounted in
+     * XQCircularLoadingIndicator::GetTotalCacheBytes()
+     */
+    qint64 GetFrameBytes() const { return m_frameBytes; }
+
+  signals:
+    void si_CountChanged(int count);
+
+  protected:
+    /**
+     * @brief Advances the shared phase to the base tick containing now and
+     * returns it. Called by every member's animation thread, the phase is
+     * integrated once per tick no matter how many members ask.
+     *
+     * @param now Clock time of the calling member in milliseconds
+     * @param minSpeed Speed range of the calling member
+     * @param maxSpeed Speed range of the calling member
+     */
+    double _Advance(const qint64 &now, const double &minSpeed, const double &maxSpeed);
+
+    /**
+     * @brief Counts the members per visual configuration, a frame is only
+     * shared when at least two members can use it
+     *
+     * @param from Previous configuration key, empty when joining
+     * @param to New configuration key, empty when leaving
+     */
+    void _KeyChanged(const QByteArray &from, const QByteArray &to);
+    bool _Shared(const QByteArray &key) const { return m_keys.value(key) > 1; }
+
+    /**
+     * @brief Group phase and the start of the base tick it was integrated for
+     */
+    double _Current(qint64 &slot) const;
+
+    /**
+     * @brief Shared frame for a configuration, nullptr when no member has
+     * rendered it during the given tick
+     */
+    const QPixmap *_Frame(const QByteArray &key, const qint64 &slot) const;
+
+    /**
+     * @brief Cleared frame for a configuration to render the given tick into.
+     * The pixmap is kept between ticks and only reallocated when the size or
+     * the pixel ratio changes.
+     */
+    QPixmap *_FrameTarget(const QByteArray &key, const qint64 &slot, const QSize &size, const qreal &devicePixelRatio);
+    void _DropFrame(const QByteArray &key);
+
+  private:
+    friend class XQCircularLoadingIndicator;
+
+    static constexpr int MaximumGap = 1000;  //> ms without any member ticking after which the phase is not integrated
+
+    struct Frame {
+        qint64 slot = -1;  //> base tick the frame was rendered for
+        QPixmap pixmap;
+    };
+
+    QList<XQCircularLoadingIndicator *> m_indicators;
+    mutable QMutex m_mutex;  //> guards the phase, advanced from the animation threads
+    double m_value = 0;
+    qint64 m_slot = -1;  //> start of the last integrated base tick, -1 before the first
+    QHash<QByteArray, int> m_keys;
+    QHash<QByteArray, Frame> m_frames;
+    qint64 m_frameBytes = 0;
+};
+
+}  // namespace Widgets
+}  // namespace Qt
+}  // namespace xaprier
+
+#endif  // XQCIRCULARLOADINGINDICATORGROUP_HPP
@@ -0,0 +1,111 @@
+#ifndef XQCIRCULARLOADINGINDICATORPOLICY_HPP
+#define XQCIRCULARLOADINGINDICATORPOLICY_HPP
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QObject>
+#include <QThread>
+#include <QTimer>
+#include <atomic>
+#include <cmath>
+
+namespace xaprier {
+namespace Qt {
+namespace Widgets {
+/**
+ * @brief Process-wide animation policy shared by every indicator. Indicators
+ * report their measured paint time here; once per window the policy compares
+ * the combined cost against the paint budget and lowers the tick rate (and
+ * eventually the render tier) of all indicators together.
+ */
+class XQCircularLoadingIndicatorPolicy : public QObject {
+    Q_OBJECT
+    Q_PROPERTY(double paintBudget READ GetPaintBudget WRITE SetPaintBudget NOTIFY si_PaintBudgetChanged)
+    Q_PROPERTY(bool lowPower READ GetLowPower WRITE SetLowPower NOTIFY si_LowPowerChanged)
+    Q_PROPERTY(int tickInterval READ GetTickInterval NOTIFY si_TickIntervalChanged)
+    Q_PROPERTY(RenderTier renderTier READ GetRenderTier NOTIFY si_RenderTierChanged)
+
+  public:
+    enum class RenderTier {
+        Full,     //> antialiased, every feature enabled
+        Reduced,  //> no antialiasing
+    };
+    Q_ENUM(RenderTier)
+
+    static constexpr int BaseTickInterval = 10;       //> ms, the unthrottled animation tick
+    static constexpr int MaximumTickInterval = 100;   //> ms, never tick slower than 10 fps
+    static constexpr int LowPowerTickInterval = 40;   //> ms, 25 fps while low power mode is on
+    static constexpr int WindowInterval = 1000;       //> ms, measurement window
+
+    /**
+     * @brief Returns the process-wide policy, creating it on first use. Must be
+     * first called from the GUI thread.
+     */
+    static XQCircularLoadingIndicatorPolicy *Instance();
+
+    //* Delete copy constructor and assignment operator
+    XQCircularLoadingIndicatorPolicy(const XQCircularLoadingIndicatorPolicy &) = delete;
+    XQCircularLoadingIndicatorPolicy &operator=(const XQCircularLoadingIndicatorPolicy &) = delete;
+
+    /**
+     * @brief Records the duration of one paint. Called by indicators at the end
+     * of paintEvent, and from the animation thread for frames rendered there.
+     *
+     * @param nsecs Paint duration in nanoseconds
+     */
+    void ReportPaint(const qint64 &nsecs);
+
+    ///< SETTERS
+    void SetPaintBudget(const double &msPerSecond = 50.0);
+    void SetLowPower(const bool &enable = false);
+
+    ///< GETTERS
+    double GetPaintBudget() const { return m_paintBudget; }
+    bool GetLowPower() const { return m_lowPower; }
+    double GetMeasuredLoad() const { return m_measuredLoad; }
+
+    /**
+     * @brief Current animation tick interval in milliseconds. Safe to call from
+     * the animation threads.
+     */
+    int GetTickInterval() const { return m_tickInterval.load(std::memory_order_relaxed); }
+    RenderTier GetRenderTier() const { return m_renderTier; }
+
+  signals:
+    void si_PaintBudgetChanged(double msPerSecond);
+    void si_LowPowerChanged(bool enable);
+    void si_TickIntervalChanged(int interval);
+    void si_RenderTierChanged(RenderTier tier);
+    void si_MeasuredLoadChanged(double msPerSecond);
+
+  protected:
+    /**
+     * @brief Closes the current measurement window and adapts the tick interval
+     * and render tier to the measured load
+     */
+    void _Evaluate();
+
+  private:
+    static XQCircularLoadingIndicatorPolicy *instance;
+    explicit XQCircularLoadingIndicatorPolicy(QObject *parent = nullptr);
+
+    void _Apply(const int &interval, const RenderTier &tier);
+    void _StartWindow();
+
+    double m_paintBudget = 50.0;  //> ms of paint time per second, all indicators combined
+    bool m_lowPower = false;
+    double m_measuredLoad = 0;
+    std::atomic<qint64> m_windowPaintNs{0};  //> also reported from the animation threads
+    std::atomic<bool> m_windowActive{false};
+    std::atomic<int> m_tickInterval{BaseTickInterval};
+    RenderTier m_renderTier = RenderTier::Full;
+    QTimer m_window;
+    QElapsedTimer m_windowClock;
+};
+
+}  // namespace Widgets
+}  // namespace Qt
+}  // namespace xaprier
+
+#endif  // XQCIRCULARLOADINGINDICATORPOLICY_HPP
@@ -0,0 +1,149 @@
+#ifndef XQCIRCULARLOADINGINDICATORSTYLES_HPP
+#define XQCIRCULARLOADINGINDICATORSTYLES_HPP
+
+#include <QBrush>
+#include <QColor>
+#include <QConicalGradient>
+#include <QImage>
+#include <QLineF>
+#include <QPaintEngine>
+#include <QPainter>
+#include <QPen>
+#include <QRectF>
+#include <QTransform>
+#include <QVector>
+#include <cmath>
+
+namespace xaprier {
+namespace Qt {
+namespace Widgets {
+/**
+ * @brief Style policies for the indicator's renderer. Every style is a plain
+ * struct with static functions and its own Geometry, prepared once per layout
+ * or property change; the indicator selects the style once per frame and the
+ * per-primitive loops are compiled for each style, without virtual calls.
+ * Offscreen textures are built separately by PrepareTexture(), only when the
+ * indicator rebuilds its caches, so a live resize never rasterizes.
+ *
+ * Angles follow QPainter::drawArc: degrees, counter-clockwise, 0 at 3 o'clock.
+ * In trail mode (indeterminate) the head is at start and the trail extends
+ * over span; otherwise the range [start, start + span] is filled evenly.
+ */
+namespace Styles {
+/**
+ * @brief Inputs shared by every style
+ */
+struct Params {
+    QRectF rect;  //> bounding rect of the ring center line
+    qreal penWidth = 0;
+    QColor color;
+    QColor bgColor;
+    bool roundedCap = true;
+    bool flatCap = false;       //> end exactly at the span, overrides roundedCap
+    int segmentSize = 12;       //> degrees
+    bool tail = false;          //> fade the moving segment towards its end
+    bool texture = true;        //> offscreen textures allowed, false when over the cache limit
+    qreal devicePixelRatio = 1;
+};
+
+/**
+ * @brief Single arc segment, the original look. With a tail the segment fades
+ * out along a conical gradient that is built once per color and segment size
+ * and only rotated per frame through the brush transform. On the raster
+ * engine the same gradient is sampled from a texture rasterized once, so the
+ * per-pixel cost is a transformed texture fetch instead of a gradient lookup.
+ * Prepare() invalidates the texture and Draw() falls back to the gradient
+ * until PrepareTexture() rasterizes it for the new geometry.
+ */
+struct Arc {
+    struct Geometry {
+        QRectF rect;
+        QPen pen;
+        QPen bgPen;
+        bool tail = false;
+        QPen gradientPen;            //> conical gradient at angle 0, head at position 0
+        QPen texturePen;             //> the same gradient rasterized into an image
+        QTransform textureTransform; //> texture pixels to logical coordinates
+        qint64 textureBytes = 0;     //> 0 without a texture
+        bool textureCurrent = false; //> the texture matches rect and gradient, false from Prepare() until PrepareTexture()
+    };
+
+    static void Prepare(Geometry &geometry, const Params &params);
+    static void PrepareTexture(Geometry &geometry, const Params &params);
+    static qint64 Bytes(const Geometry &geometry);
+    static void DrawBackground(QPainter &painter, const Geometry &geometry);
+    static void Draw(QPainter &painter, const Geometry &geometry, const double &start, const double &span, const bool &trail);
+};
+
+/**
+ * @brief Two concentric arcs rotating in opposite directions
+ */
+struct DualArc {
+    struct Geometry {
+        Arc::Geometry outer;
+        Arc::Geometry inner;
+        bool hasInner = false;  //> too small rings only draw the outer arc
+    };
+
+    static void Prepare(Geometry &geometry, const Params &params);
+    static void PrepareTexture(Geometry &geometry, const Params &params);
+    static qint64 Bytes(const Geometry &geometry);
+    static void DrawBackground(QPainter &painter, const Geometry &geometry);
+    static void Draw(QPainter &painter, const Geometry &geometry, const double &start, const double &span, const bool &trail);
+};
+
+/**
+ * @brief Ring of dots, lit with a fading trail
+ */
+struct Dots {
+    static constexpr int Count = 12;
+    static constexpr int Trail = 4;  //> minimum number of lit dots in trail mode
+
+    struct Geometry {
+        QVector<QRectF> dots;    //> dot bounding rects, clockwise from 12 o'clock
+        QVector<double> angles;  //> dot angles in degrees
+        QVector<QBrush> ramp;    //> brush per trail position, head first
+        QBrush bgBrush;
+    };
+
+    static void Prepare(Geometry &geometry, const Params &params);
+    static void PrepareTexture(Geometry &geometry, const Params &params);
+    static qint64 Bytes(const Geometry &geometry);
+    static void DrawBackground(QPainter &painter, const Geometry &geometry);
+    static void Draw(QPainter &painter, const Geometry &geometry, const double &start, const double &span, const bool &trail);
+};
+
+/**
+ * @brief Radial bars, lit with a fading trail
+ */
+struct Bars {
+    static constexpr int Count = 12;
+    static constexpr int Trail = 6;  //> minimum number of lit bars in trail mode
+
+    struct Geometry {
+        QVector<QLineF> bars;    //> bars from inner to outer radius, clockwise from 12 o'clock
+        QVector<double> angles;  //> bar angles in degrees
+        QVector<QPen> ramp;      //> pen per trail position, head first
+        QPen bgPen;
+    };
+
+    static void Prepare(Geometry &geometry, const Params &params);
+    static void PrepareTexture(Geometry &geometry, const Params &params);
+    static qint64 Bytes(const Geometry &geometry);
+    static void DrawBackground(QPainter &painter, const Geometry &geometry);
+    static void Draw(QPainter &painter, const Geometry &geometry, const double &start, const double &span, const bool &trail);
+};
+
+/**
+ * @brief Position of a discrete element within the drawn range
+ *
+ * @return Distance from the head in degrees, negative if the element is unlit
+ */
+double Distance(const double &angle, const double &start, const double &span);
+
+}  // namespace Styles
+}  // namespace Widgets
+}  // namespace Qt
+}  // namespace xaprier
+
+#endif  // XQCIRCULARLOADINGINDICATORSTYLES_HPP
@@ -0,0 +1,126 @@
+#ifndef XQCIRCULARLOADINGINDICATORTRACE_HPP
+#define XQCIRCULARLOADINGINDICATORTRACE_HPP
+
+#include <QByteArray>
+#include <QCoreApplication>
+#include <QDebug>
+#include <QFile>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QString>
+#include <QThread>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace xaprier {
+namespace Qt {
+namespace Widgets {
+/**
+ * @brief Opt-in event recorder writing Chrome trace JSON, loadable in
+ * chrome://tracing or Perfetto. Every thread records into its own lock-free
+ * ring buffer; Flush() drains all of them into a file and frees the buffers
+ * of threads that have exited. Timestamps are absolute
+ * monotonic time (CLOCK_MONOTONIC on Linux) and thread ids are the OS ids, so
+ * the file lines up with the application's own traces. Setting the
+ * XQ_INDICATOR_TRACE environment variable to a file path enables recording at
+ * startup and flushes to that path when the application exits.
+ */
+class XQCircularLoadingIndicatorTrace {
+  public:
+    /**
+     * @brief Records a begin event on construction and the matching end event
+     * on destruction. Costs a single atomic load while tracing is disabled.
+     */
+    class Scope {
+      public:
+        Scope(const char *name, const void *object) : m_name(name), m_object(object), m_enabled(IsEnabled()) {
+            if (m_enabled) Record(m_name, 'B', m_object);
+        }
+        ~Scope() {
+            if (m_enabled) Record(m_name, 'E', m_object);
+        }
+
+        //* Delete copy constructor and assignment operator
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+      private:
+        const char *m_name;
+        const void *m_object;
+        bool m_enabled;
+    };
+
+    static void SetEnabled(const bool &enable = false);
+    static bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Records an instant event
+     *
+     * @param name Event name, must be a string literal
+     * @param object Indicator the event belongs to, recorded as an argument
+     */
+    static void Instant(const char *name, const void *object) {
+        if (IsEnabled()) Record(name, 'i', object);
+    }
+
+    /**
+     * @brief Drains every thread's buffer into a Chrome trace JSON file
+     *
+     * @param path Output file path
+     * @return true if the file was written
+     */
+    static bool Flush(const QString &path);
+
+  private:
+    struct Event {
+        const char *name;
+        char phase;
+        qint64 timestamp;  //> ns of the monotonic clock
+        const void *object;
+    };
+
+    /**
+     * @brief Single producer (the owning thread), single consumer (Flush())
+     * ring. Full buffers drop new events instead of blocking the producer.
+     */
+    struct Buffer {
+        static constexpr quint32 Capacity = 1u << 14;
+
+        Event events[Capacity];
+        std::atomic<quint32> head{0};
+        std::atomic<quint32> tail{0};
+        std::atomic<quint64> dropped{0};
+        qint64 tid = 0;  //> OS thread id
+        QByteArray threadName;
+        std::atomic<bool> alive{true};  //> cleared when the thread exits, freed by the next Flush()
+    };
+
+    /**
+     * @brief Thread local handle of the thread's buffer, marks it dead when
+     * the thread exits so finished workers don't keep their buffer forever
+     */
+    struct Owner {
+        Buffer *buffer = nullptr;
+        ~Owner() {
+            if (buffer) buffer->alive.store(false, std::memory_order_release);
+        }
+    };
+
+    static void Record(const char *name, const char &phase, const void *object);
+    static Buffer *_ThreadBuffer();
+    static qint64 _Now();
+    static qint64 _ThreadId();
+
+    static std::atomic<bool> enabled;
+    static QMutex registryMutex;
+    static std::vector<std::unique_ptr<Buffer>> registry;  //> outlives the threads until Flush() has drained their events
+};
+
+}  // namespace Widgets
+}  // namespace Qt
+}  // namespace xaprier
+
+#endif  // XQCIRCULARLOADINGINDICATORTRACE_HPP
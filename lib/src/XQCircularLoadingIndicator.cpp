@@ -1,15 +1,60 @@
 #include "XQCircularLoadingIndicator.hpp"
 
+#ifdef Q_OS_WIN
+#define NOMINMAX
+#include <windows.h>
+#endif
+
 namespace xaprier {
 namespace Qt {
 namespace Widgets {
-XQCircularLoadingIndicator::XQCircularLoadingIndicator(QWidget *parent) : QWidget(parent), m_superClass(parent) {
+std::atomic<qint64> XQCircularLoadingIndicator::totalCacheBytes{0};
+std::atomic<qint64> XQCircularLoadingIndicator::globalCacheLimit{0};
+
+XQCircularLoadingIndicator::XQCircularLoadingIndicator(QWidget *parent)
+    : QWidget(parent), m_superClass(parent), m_policy(XQCircularLoadingIndicatorPolicy::Instance()) {
     setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
     resize(m_width, m_height);
     updateGeometry();
+    m_lowDamage = IsRemoteSession();
+    m_guard->owner = this;
+    m_showTimer.setSingleShot(true);
+    m_stopTimer.setSingleShot(true);
+    connect(&m_showTimer, &QTimer::timeout, this, &XQCircularLoadingIndicator::_Launch);
+    connect(&m_stopTimer, &QTimer::timeout, this, &XQCircularLoadingIndicator::_Finish);
+    m_staticText.setTextFormat(::Qt::PlainText);
+    m_staticText.setPerformanceHint(QStaticText::AggressiveCaching);
+    m_resizeTimer.setSingleShot(true);
+    m_resizeTimer.setInterval(ResizeSettleInterval);
+    connect(&m_resizeTimer, &QTimer::timeout, this, [this]() {
+        _RebuildCaches();
+        update();
+    });
+    connect(m_policy, &XQCircularLoadingIndicatorPolicy::si_RenderTierChanged, this, &XQCircularLoadingIndicator::_PublishSnapshot);
+    _UpdateLayout();
+    _RebuildCaches();
 }
 
-XQCircularLoadingIndicator::~XQCircularLoadingIndicator() { this->Stop(); }
+XQCircularLoadingIndicator::~XQCircularLoadingIndicator() {
+    if (m_group) m_group->RemoveIndicator(this);
+
+    // owned watchers are deleted by ~QWidget, after our members are gone
+    for (auto *watcher : m_tracked.keys()) disconnect(watcher, nullptr, this, nullptr);
+    m_tracked.clear();
+
+    // leave the task to the driver instead of waiting for it, it checks the
+    // guard before every tick and drops the task; queued repaints die with us
+    {
+        QMutexLocker locker(&m_guard->mutex);
+        m_guard->owner = nullptr;
+    }
+    if (m_animation) {
+        m_animation->store(false);
+        m_clock->Wake();
+    }
+
+    totalCacheBytes.fetch_sub(m_cacheBytes, std::memory_order_relaxed);
+}
 
 void XQCircularLoadingIndicator::SetMaximumSpeed(const double &maximumSpeed) {
     if (m_running) {
@@ -62,6 +107,7 @@ void XQCircularLoadingIndicator::SetSegmentSize(const int &segmentSize) {
     }
     this->m_segmentSize = segmentSize % m_circularDegree;
     emit si_SegmentChanged(segmentSize % m_circularDegree);
+    _RebuildCaches();
     update();
     repaint();
 }
@@ -77,9 +123,10 @@ void XQCircularLoadingIndicator::SetWidth(const int &width) {
     if (m_width != width) {
         m_width = width;
         emit si_WidthChanged(width);
-        QResizeEvent event(this->size(), this->size());
-        this->resizeEvent(&event);
-        repaint();
+        _UpdateGeometry(this->size());
+        _UpdateLayout();
+        _RebuildCaches();
+        update();
     }
 }
 
@@ -94,9 +141,10 @@ void XQCircularLoadingIndicator::SetHeight(const int &height) {
     if (m_height != height) {
         m_height = height;
         emit si_HeightChanged(height);
-        QResizeEvent event(this->size(), this->size());
-        this->resizeEvent(&event);
-        repaint();
+        _UpdateGeometry(this->size());
+        _UpdateLayout();
+        _RebuildCaches();
+        update();
     }
 }
 
@@ -112,6 +160,8 @@ void XQCircularLoadingIndicator::SetMargin(const int &x, const int &y) {
         m_marginX = x;
         m_marginY = y;
         emit si_MarginChanged(x, y);
+        _UpdateLayout();
+        _RebuildCaches();
         update();
         repaint();
     }
@@ -128,6 +178,8 @@ void XQCircularLoadingIndicator::SetMarginX(const int &x) {
     if (m_marginX != x) {
         m_marginX = x;
         emit si_MarginXChanged(x);
+        _UpdateLayout();
+        _RebuildCaches();
         update();
         repaint();
     }
@@ -144,6 +196,8 @@ void XQCircularLoadingIndicator::SetMarginY(const int &y) {
     if (m_marginY != y) {
         m_marginY = y;
         emit si_MarginYChanged(y);
+        _UpdateLayout();
+        _RebuildCaches();
         update();
         repaint();
     }
@@ -160,11 +214,41 @@ void XQCircularLoadingIndicator::SetProgressWidth(const int &width) {
     if (m_progressWidth != width) {
         m_progressWidth = width;
         emit si_ProgressWidthChanged(width);
+        _UpdateLayout();
+        _RebuildCaches();
         update();
         repaint();
     }
 }
 
+void XQCircularLoadingIndicator::SetShowDelay(const int &delay) {
+    if (delay < 0) {
+        qDebug() << QObject::tr(
+            "Show delay cannot be negative. Please provide a value greater "
+            "than or equal to zero.");
+        return;
+    }
+
+    if (m_showDelay != delay) {
+        m_showDelay = delay;
+        emit si_ShowDelayChanged(delay);
+    }
+}
+
+void XQCircularLoadingIndicator::SetMinimumVisibleTime(const int &time) {
+    if (time < 0) {
+        qDebug() << QObject::tr(
+            "Minimum visible time cannot be negative. Please provide a value "
+            "greater than or equal to zero.");
+        return;
+    }
+
+    if (m_minimumVisibleTime != time) {
+        m_minimumVisibleTime = time;
+        emit si_MinimumVisibleTimeChanged(time);
+    }
+}
+
 void XQCircularLoadingIndicator::SetSquare(const bool &enable) {
     if (m_running) {
         qDebug() << QObject::tr(
@@ -176,9 +260,10 @@ void XQCircularLoadingIndicator::SetSquare(const bool &enable) {
     if (m_square != enable) {
         m_square = enable;
         emit si_SquareChanged(enable);
-        QResizeEvent event(this->size(), this->size());
-        this->resizeEvent(&event);
-        repaint();
+        _UpdateGeometry(this->size());
+        _UpdateLayout();
+        _RebuildCaches();
+        update();
     }
 }
 
@@ -204,6 +289,7 @@ void XQCircularLoadingIndicator::SetShadow(const bool &enable) {
         }
         m_shadow = enable;
         emit si_ShadowChanged(enable);
+        _AccountCaches();
         update();
     }
 }
@@ -219,8 +305,24 @@ void XQCircularLoadingIndicator::SetProgressRoundedCap(const bool &enable) {
     if (m_progressRoundedCap != enable) {
         m_progressRoundedCap = enable;
         emit si_ProgressRoundedCapChanged(enable);
+        _RebuildCaches();
+        update();
+    }
+}
+
+void XQCircularLoadingIndicator::SetTail(const bool &enable) {
+    if (m_running) {
+        qDebug() << QObject::tr(
+            "Cannot change tail while running. Please stop the "
+            "indicator before changing the tail.");
+        return;
+    }
+
+    if (m_tail != enable) {
+        m_tail = enable;
+        emit si_TailChanged(enable);
+        _RebuildCaches();
         update();
-        repaint();
     }
 }
 
@@ -235,8 +337,8 @@ void XQCircularLoadingIndicator::SetEnableBg(const bool &enable) {
     if (m_enableBg != enable) {
         m_enableBg = enable;
         emit si_EnableBgChanged(enable);
+        _RebuildCaches();
         update();
-        repaint();
     }
 }
 
@@ -250,12 +352,209 @@ void XQCircularLoadingIndicator::SetEnableText(const bool &enable) {
 
     if (m_enableText != enable) {
         m_enableText = enable;
-        emit si_EnableBgChanged(enable);
+        emit si_EnableTextChanged(enable);
+        _UpdateLayout();
+        _RebuildCaches();
         update();
         repaint();
     }
 }
 
+void XQCircularLoadingIndicator::SetTextElide(const bool &enable) {
+    if (m_running && !m_enableText) {
+        qDebug() << QObject::tr(
+            "Cannot change text elide while running. Please stop the "
+            "indicator before changing the text elide.");
+        return;
+    }
+
+    if (m_textElide != enable) {
+        m_textElide = enable;
+        emit si_TextElideChanged(enable);
+        _UpdateLayout();
+        _RebuildCaches();
+        update();
+    }
+}
+
+void XQCircularLoadingIndicator::SetTextAutoFit(const bool &enable) {
+    if (m_running && !m_enableText) {
+        qDebug() << QObject::tr(
+            "Cannot change text auto fit while running. Please stop the "
+            "indicator before changing the text auto fit.");
+        return;
+    }
+
+    if (m_textAutoFit != enable) {
+        m_textAutoFit = enable;
+        emit si_TextAutoFitChanged(enable);
+        _UpdateLayout();
+        _RebuildCaches();
+        update();
+    }
+}
+
+void XQCircularLoadingIndicator::SetStyle(const Style &style) {
+    if (m_running) {
+        qDebug() << QObject::tr(
+            "Cannot change style while running. Please stop the "
+            "indicator before changing the style.");
+        return;
+    }
+
+    if (m_style != style) {
+        m_style = style;
+        emit si_StyleChanged(style);
+        _RebuildCaches();
+        update();
+    }
+}
+
+void XQCircularLoadingIndicator::SetLowDamage(const bool &enable) {
+    if (m_running) {
+        qDebug() << QObject::tr(
+            "Cannot change low damage while running. Please stop the "
+            "indicator before changing the low damage.");
+        return;
+    }
+
+    if (m_lowDamage != enable) {
+        m_lowDamage = enable;
+        emit si_LowDamageChanged(enable);
+        _UpdateFrameKey();
+        update();
+    }
+}
+
+void XQCircularLoadingIndicator::SetLowDamageStep(const int &degrees) {
+    if (m_running) {
+        qDebug() << QObject::tr(
+            "Cannot change low damage step while running. Please stop the "
+            "indicator before changing the low damage step.");
+        return;
+    }
+
+    if (degrees < 1 || degrees > m_circularDegree) {
+        qDebug() << QObject::tr(
+            "Low damage step must be between 1 and 360 degrees. Please "
+            "provide a value in this range.");
+        return;
+    }
+
+    if (m_lowDamageStep != degrees) {
+        m_lowDamageStep = degrees;
+        emit si_LowDamageStepChanged(degrees);
+        _UpdateFrameKey();
+        update();
+    }
+}
+
+void XQCircularLoadingIndicator::SetLowDamageAntialiasing(const bool &enable) {
+    if (m_running) {
+        qDebug() << QObject::tr(
+            "Cannot change low damage antialiasing while running. Please stop the "
+            "indicator before changing the low damage antialiasing.");
+        return;
+    }
+
+    if (m_lowDamageAntialiasing != enable) {
+        m_lowDamageAntialiasing = enable;
+        emit si_LowDamageAntialiasingChanged(enable);
+        _UpdateFrameKey();
+        update();
+    }
+}
+
+void XQCircularLoadingIndicator::SetThreadedRendering(const bool &enable) {
+    if (m_running) {
+        qDebug() << QObject::tr(
+            "Cannot change threaded rendering while running. Please stop the "
+            "indicator before changing the threaded rendering.");
+        return;
+    }
+
+    if (m_threadedRendering != enable) {
+        m_threadedRendering = enable;
+        emit si_ThreadedRenderingChanged(enable);
+        _RebuildCaches();
+        update();
+    }
+}
+
+void XQCircularLoadingIndicator::SetSmallDetailSize(const int &pixels) {
+    if (m_running) {
+        qDebug() << QObject::tr(
+            "Cannot change small detail size while running. Please stop the "
+            "indicator before changing the small detail size.");
+        return;
+    }
+
+    if (pixels < 0) {
+        qDebug() << QObject::tr(
+            "Small detail size cannot be negative. Please provide a size in "
+            "device pixels, or 0 to disable the tier.");
+        return;
+    }
+
+    if (m_smallDetailSize != pixels) {
+        m_smallDetailSize = pixels;
+        emit si_SmallDetailSizeChanged(pixels);
+        _UpdateLayout();
+        _RebuildCaches();
+        update();
+    }
+}
+
+void XQCircularLoadingIndicator::SetTinyDetailSize(const int &pixels) {
+    if (m_running) {
+        qDebug() << QObject::tr(
+            "Cannot change tiny detail size while running. Please stop the "
+            "indicator before changing the tiny detail size.");
+        return;
+    }
+
+    if (pixels < 0) {
+        qDebug() << QObject::tr(
+            "Tiny detail size cannot be negative. Please provide a size in "
+            "device pixels, or 0 to disable the tier.");
+        return;
+    }
+
+    if (m_tinyDetailSize != pixels) {
+        m_tinyDetailSize = pixels;
+        emit si_TinyDetailSizeChanged(pixels);
+        _UpdateLayout();
+        _RebuildCaches();
+        update();
+    }
+}
+
+bool XQCircularLoadingIndicator::IsRemoteSession() {
+    static const bool remote = []() {
+#ifdef Q_OS_WIN
+        if (GetSystemMetrics(SM_REMOTESESSION)) return true;
+#endif
+        // Qt's own VNC platform plugin
+        if (QGuiApplication::platformName() == QLatin1String("vnc")) return true;
+
+        // xrdp and VNC desktops announce themselves
+        if (qEnvironmentVariableIsSet("XRDP_SESSION") || qEnvironmentVariableIsSet("VNCDESKTOP")) return true;
+
+        // only when drawing through X11, XQuartz sets DISPLAY on a local macOS session
+        if (QGuiApplication::platformName() != QLatin1String("xcb")) return false;
+
+        // X11 over the network ("host:0") or forwarded through ssh ("localhost:10")
+        auto display = qEnvironmentVariable("DISPLAY");
+        auto host = display.section(QLatin1Char(':'), 0, 0);
+        if (!host.isEmpty() && host != QLatin1String("unix")) {
+            auto local = host == QLatin1String("localhost") || host == QLatin1String("127.0.0.1");
+            if (!local || qEnvironmentVariableIsSet("SSH_CONNECTION")) return true;
+        }
+        return false;
+    }();
+    return remote;
+}
+
 void XQCircularLoadingIndicator::SetProgressAlignment(const ::Qt::Alignment &alignment) {
     if (m_running) {
         qDebug() << QObject::tr(
@@ -267,8 +566,10 @@ void XQCircularLoadingIndicator::SetProgressAlignment(const ::Qt::Alignment &ali
     if (m_progressAlignment != alignment) {
         m_progressAlignment = alignment;
         emit si_ProgressAlignmentChanged(alignment);
+        _UpdateGeometry(this->size());
+        _UpdateLayout();
+        _RebuildCaches();
         update();
-        repaint();
     }
 }
 
@@ -283,8 +584,8 @@ void XQCircularLoadingIndicator::SetBgColor(const QColor &color) {
     if (m_bgColor != color) {
         m_bgColor = color;
         emit si_BgColorChanged(color);
+        _RebuildCaches();
         update();
-        repaint();
     }
 }
 
@@ -299,6 +600,7 @@ void XQCircularLoadingIndicator::SetProgressColor(const QColor &color) {
     if (m_progressColor != color) {
         m_progressColor = color;
         emit si_ProgressColorChanged(color);
+        _RebuildCaches();
         update();
         repaint();
     }
@@ -314,9 +616,9 @@ void XQCircularLoadingIndicator::SetTextColor(const QColor &color) {
 
     if (m_textColor != color) {
         m_textColor = color;
-        emit si_ProgressColorChanged(color);
+        emit si_TextColorChanged(color);
+        _RebuildCaches();
         update();
-        repaint();
     }
 }
 
@@ -331,118 +633,960 @@ void XQCircularLoadingIndicator::SetText(const QString &text) {
     if (m_text != text) {
         m_text = text;
         emit si_TextChanged(text);
+        _UpdateLayout();
+        _RebuildCaches();
         update();
         repaint();
     }
 }
 
-void XQCircularLoadingIndicator::Start() {
+void XQCircularLoadingIndicator::SetProgressRange(const int &minimum, const int &maximum) {
+    if (maximum < minimum) {
+        qDebug() << QObject::tr(
+            "Progress maximum cannot be less than progress minimum. Please "
+            "provide a value greater than or equal to the minimum.");
+        return;
+    }
+
+    if (m_progressMinimum != minimum || m_progressMaximum != maximum) {
+        m_progressMinimum = minimum;
+        m_progressMaximum = maximum;
+        m_progressValue = qBound(minimum, m_progressValue, maximum);
+        m_determinate = minimum < maximum;
+        emit si_ProgressRangeChanged(minimum, maximum);
+        update();
+    }
+}
+
+void XQCircularLoadingIndicator::SetProgressValue(const int &value) {
+    auto bounded = qBound(m_progressMinimum, value, m_progressMaximum);
+    if (m_progressValue != bounded) {
+        m_progressValue = bounded;
+        emit si_ProgressValueChanged(bounded);
+        update();
+    }
+}
+
+void XQCircularLoadingIndicator::SetClock(XQCircularLoadingIndicatorClock *clock) {
+    if (m_running) {
+        qDebug() << QObject::tr(
+            "Cannot change clock while running. Please stop the "
+            "indicator before changing the clock.");
+        return;
+    }
+
+    m_clock = clock ? clock : XQCircularLoadingIndicatorClock::System();
+}
+
+void XQCircularLoadingIndicator::SetCurrentValue(const double &value) {
+    if (m_running) {
+        qDebug() << QObject::tr(
+            "Cannot change current value while running. Please stop the "
+            "indicator before changing the current value.");
+        return;
+    }
+
+    m_currentValue.store(value, std::memory_order_relaxed);
+    update();
+}
+
+void XQCircularLoadingIndicator::SetCacheLimit(const qint64 &bytes) {
+    if (bytes < 0) {
+        qDebug() << QObject::tr(
+            "Cache limit cannot be negative. Please provide a value greater "
+            "than or equal to zero.");
+        return;
+    }
+
+    if (m_cacheLimit != bytes) {
+        m_cacheLimit = bytes;
+        emit si_CacheLimitChanged(bytes);
+        _RebuildCaches();
+        update();
+    }
+}
+
+void XQCircularLoadingIndicator::SetGlobalCacheLimit(const qint64 &bytes) {
+    // applies to every indicator from its next cache rebuild on
+    globalCacheLimit.store(qMax<qint64>(0, bytes), std::memory_order_relaxed);
+}
+
+void XQCircularLoadingIndicator::Track(QFutureWatcherBase *watcher) {
+    if (watcher == nullptr || m_tracked.contains(watcher)) return;
+
+    TrackedFuture tracked;
+    tracked.started = watcher->isStarted() && !watcher->isFinished();
+    tracked.minimum = watcher->progressMinimum();
+    tracked.maximum = watcher->progressMaximum();
+    tracked.value = watcher->progressValue();
+    m_tracked.insert(watcher, tracked);
+
+    // everything is driven by the watcher's signals, nothing polls the future
+    connect(watcher, &QFutureWatcherBase::started, this, [this, watcher]() {
+        m_tracked[watcher].started = true;
+        _UpdateTracked();
+    });
+    connect(watcher, &QFutureWatcherBase::progressRangeChanged, this, [this, watcher](int minimum, int maximum) {
+        m_tracked[watcher].minimum = minimum;
+        m_tracked[watcher].maximum = maximum;
+        _UpdateTracked();
+    });
+    connect(watcher, &QFutureWatcherBase::progressValueChanged, this, [this, watcher](int value) {
+        m_tracked[watcher].value = value;
+        _UpdateTracked();
+    });
+    connect(watcher, &QFutureWatcherBase::canceled, this, [this, watcher]() { Untrack(watcher); });
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher]() { Untrack(watcher); });
+    connect(watcher, &QObject::destroyed, this, [this, watcher]() { Untrack(watcher); });
+
+    _UpdateTracked();
+}
+
+void XQCircularLoadingIndicator::Untrack(QFutureWatcherBase *watcher) {
+    if (!m_tracked.remove(watcher)) return;
+
+    disconnect(watcher, nullptr, this, nullptr);
+    _UpdateTracked();
+}
+
+void XQCircularLoadingIndicator::_UpdateTracked() {
+    int active = 0;
+    qint64 done = 0, total = 0;
+    for (const auto &tracked : std::as_const(m_tracked)) {
+        if (!tracked.started) continue;
+        active++;
+        if (tracked.maximum > tracked.minimum) {
+            done += qBound(tracked.minimum, tracked.value, tracked.maximum) - tracked.minimum;
+            total += tracked.maximum - tracked.minimum;
+        }
+    }
+
+    // aggregate progress of all reporting futures, normalized to per mille
+    if (total > 0) {
+        m_trackedRange = true;
+        SetProgressRange(0, 1000);
+        SetProgressValue(static_cast<int>(done * 1000 / total));
+    } else if (active > 0 && m_trackedRange) {
+        // only a range set by Track() is ours to reset, not the user's
+        m_trackedRange = false;
+        SetProgressRange(0, 0);
+    }
+
+    // a deferred stop still counts as running, Start() cancels it
+    if (active > 0 && (!m_running || m_stopTimer.isActive())) {
+        m_trackedStart = true;
+        Start();
+    } else if (active == 0 && m_trackedStart) {
+        // the range is reset by _Finish(), so the final progress stays visible
+        // for the minimum visible time
+        m_trackedStart = false;
+        Stop();
+    } else if (active == 0 && m_trackedRange) {
+        // started by the user, who keeps it spinning after the last future
+        m_trackedRange = false;
+        SetProgressRange(0, 0);
+    }
+}
+
+void XQCircularLoadingIndicator::Start(const int &delay) {
+    XQCircularLoadingIndicatorTrace::Instant("Start", this);
     if (this->m_running) {
+        // restarted while a deferred stop is pending, keep animating
+        if (m_stopTimer.isActive()) {
+            m_stopTimer.stop();
+            return;
+        }
         qDebug() << QObject::tr("Indicator is already running.");
         return;
     }
 
     this->m_running = true;
 
-    // Launch a background thread using QtConcurrent
-    this->m_future = QtConcurrent::run([this]() {
-        while (m_running) {
-            this->_Progress();  // Update progress
-            QThread::msleep(10);
+    auto showDelay = delay < 0 ? m_showDelay : delay;
+    if (showDelay > 0) {
+        m_showTimer.start(showDelay);  // no thread, no paint until the delay elapses
+        return;
+    }
+
+    _Launch();
+}
+
+void XQCircularLoadingIndicator::_Launch() {
+    if (!this->m_running || this->m_animating) return;
+    XQCircularLoadingIndicatorTrace::Instant("Launch", this);
+
+    this->m_animating = true;
+    m_visibleClock.start();
+
+    // the group moved on while we were stopped, ease back into its phase
+    if (m_group) m_groupOffset.store(std::remainder(GetCurrentValue() - m_group->GetCurrentValue(), m_circularDegree), std::memory_order_relaxed);
+
+    // Tick on the clock's shared animation thread. The task never touches the
+    // indicator outside the guard, so it can outlive Stop() and the destructor
+    // without being joined.
+    auto *clock = m_clock;
+    auto guard = m_guard;
+    auto running = std::make_shared<std::atomic<bool>>(true);
+    m_animation = running;
+    {
+        // fresh buffers, the previous launch may still be rendering into the
+        // old ones
+        QMutexLocker locker(&m_guard->mutex);
+        m_buffers = std::make_shared<Buffers>();
+    }
+
+    auto tick = [guard, running, last = clock->Elapsed(), renderedGeneration = quint64(0), renderedValue = 0.0](const qint64 &now) mutable -> int {
+        int interval;
+        std::shared_ptr<const Snapshot> snapshot;
+        std::shared_ptr<Buffers> buffers;
+        double value = 0;
+        const void *object = nullptr;
+        {
+            QMutexLocker locker(&guard->mutex);
+            if (guard->owner == nullptr || !running->load()) return -1;
+
+            // advance by the elapsed time, the policy may stretch the interval
+            auto *owner = guard->owner;
+            owner->_Progress(static_cast<double>(now - last) / XQCircularLoadingIndicatorPolicy::BaseTickInterval);  // Update progress
+            last = now;
+            interval = owner->_TickInterval();
+
+            // threaded rendering: take what's needed, render outside the guard
+            if (owner->m_snapshot && !owner->m_determinate) {
+                snapshot = owner->m_snapshot;
+                buffers = owner->m_buffers;
+                value = owner->_Quantize(owner->GetCurrentValue());
+                object = owner;
+            }
         }
-    });
+
+        if (snapshot && (snapshot->generation != renderedGeneration || value != renderedValue)) {
+            QElapsedTimer renderTimer;
+            renderTimer.start();
+            _Render(*buffers, *snapshot, value, object);
+            auto renderNs = renderTimer.nsecsElapsed();
+
+            // a new configuration repaints everything, otherwise low-damage
+            // mode repaints the previous and the new segment only
+            auto full = snapshot->generation != renderedGeneration;
+            auto before = renderedValue;
+            renderedGeneration = snapshot->generation;
+            renderedValue = value;
+
+            QMutexLocker locker(&guard->mutex);
+            if (auto *owner = guard->owner) {
+                owner->m_policy->ReportPaint(renderNs);  // the raster cost moved here from paintEvent
+                XQCircularLoadingIndicatorTrace::Instant("FrameRequest", owner);
+                QMetaObject::invokeMethod(
+                    owner,
+                    [owner, full, before, value]() {
+                        if (owner->m_lowDamage && !full)
+                            owner->repaint(owner->_DirtyRect(before).united(owner->_DirtyRect(value)));
+                        else
+                            owner->repaint();
+                    },
+                    ::Qt::QueuedConnection);
+            }
+        }
+        return interval;
+    };
+
+    // si_Stopped once the driver let go of the task, unless restarted meanwhile
+    auto finished = [guard]() {
+        QMutexLocker locker(&guard->mutex);
+        if (auto *owner = guard->owner)
+            QMetaObject::invokeMethod(
+                owner,
+                [owner]() {
+                    if (!owner->m_animation) emit owner->si_Stopped();
+                },
+                ::Qt::QueuedConnection);
+    };
+
+    XQCircularLoadingIndicatorDriver::Add(clock, running, tick, finished);
 }
 
 void XQCircularLoadingIndicator::Stop() {
+    XQCircularLoadingIndicatorTrace::Instant("Stop", this);
+
+    // stopped within the show delay, nothing was spawned
+    if (m_showTimer.isActive()) {
+        _Finish();
+        return;
+    }
+
+    if (m_animating && !m_stopTimer.isActive()) {
+        auto remaining = m_minimumVisibleTime - m_visibleClock.elapsed();
+        if (remaining > 0) {
+            m_stopTimer.start(static_cast<int>(remaining));
+            return;
+        }
+    }
+
+    if (!m_stopTimer.isActive()) _Finish();
+}
+
+void XQCircularLoadingIndicator::_Finish() {
+    XQCircularLoadingIndicatorTrace::Scope trace("Finish", this);
+    m_showTimer.stop();
+    m_stopTimer.stop();
+    auto wasRunning = m_running;
     m_running = false;
+    m_animating = false;
 
-    // Wait for the thread to finish
-    if (m_future.isRunning()) {
-        m_future.waitForFinished();
+    // back to the spinning segment for the next start
+    if (m_trackedRange) {
+        m_trackedRange = false;
+        SetProgressRange(0, 0);
+    }
+
+    if (m_animation) {
+        m_animation->store(false);
+        m_clock->Wake();  // don't wait for the current sleep to run out
+
+        // only waits for a tick that is already inside _Progress(), never for a
+        // sleep or a paint; afterwards the driver can no longer read the
+        // properties the setters are about to change. si_Stopped follows once
+        // the driver has dropped the task.
+        QMutexLocker locker(&m_guard->mutex);
+        m_animation.reset();
+    } else if (wasRunning) {
+        emit si_Stopped();  // nothing was spawned, teardown is already complete
     }
 }
 
-void XQCircularLoadingIndicator::_Progress() {
-    double angle = fmod(m_currentValue + 270, m_circularDegree);
+void XQCircularLoadingIndicator::_Progress(const double &ticks) {
+    XQCircularLoadingIndicatorTrace::Scope trace("Progress", this);
+
+    // determinate display is repainted by SetProgressValue(), not by the ticks
+    if (m_determinate) return;
+
+    auto previous = m_currentValue.load(std::memory_order_relaxed);
+    double value;
+    if (m_group) {
+        // the group integrates each tick once for all members, only the offset
+        // left over from joining is ours
+        auto offset = m_groupOffset.load(std::memory_order_relaxed) * std::pow(GroupCatchUp, ticks);
+        if (std::abs(offset) < GroupSnap) offset = 0;
+        m_groupOffset.store(offset, std::memory_order_relaxed);
+        value = m_group->_Advance(m_clock->Elapsed(), m_minSpeed, m_maxSpeed) + offset;
+    } else {
+        value = _Integrate(previous, ticks, m_minSpeed, m_maxSpeed);
+    }
+    m_currentValue.store(value, std::memory_order_relaxed);
 
-    // calculate speed factor with normalized sin values
-    double normalizedAngle = angle * M_PI / 180.0;                               // degree to radian
-    double speedFactor = (std::sin(normalizedAngle) + 1.0) / 2.0;                // normalized factor
-    double dynamicSpeed = m_minSpeed + speedFactor * (m_maxSpeed - m_minSpeed);  // [min, max]
+    // nothing visible changed within the same step, don't touch a pixel
+    auto before = _Quantize(previous), after = _Quantize(value);
+    if (before == after) return;
 
-    // Update progress value
-    m_currentValue += dynamicSpeed;
+    // the animation thread renders the frame and requests the blit itself
+    if (m_snapshot) return;
+
+    if (m_lowDamage) {
+        // repaint only the old and the new segment, rects are computed on the
+        // GUI thread where the layout lives
+        XQCircularLoadingIndicatorTrace::Instant("FrameRequest", this);
+        QMetaObject::invokeMethod(
+            this, [this, before, after]() { repaint(_DirtyRect(before).united(_DirtyRect(after))); }, ::Qt::QueuedConnection);
+        return;
+    }
 
     // Schedule UI update on the main thread
+    XQCircularLoadingIndicatorTrace::Instant("FrameRequest", this);
     QMetaObject::invokeMethod(
         this, [this]() { repaint(); }, ::Qt::QueuedConnection);
 }
 
-void XQCircularLoadingIndicator::paintEvent(QPaintEvent *event) {
-    QPainter painter(this);
-    auto pnwidth = m_width - m_progressWidth;
-    auto pnheight = m_height - m_progressWidth;
+double XQCircularLoadingIndicator::_Integrate(const double &value, const double &ticks, const double &minSpeed, const double &maxSpeed) {
+    auto result = value;
+    for (double remaining = ticks; remaining > 0; remaining -= 1.0) {
+        double angle = fmod(result + 270, 360.0);
+
+        // calculate speed factor with normalized sin values
+        double normalizedAngle = angle * M_PI / 180.0;                           // degree to radian
+        double speedFactor = (std::sin(normalizedAngle) + 1.0) / 2.0;            // normalized factor
+        double dynamicSpeed = minSpeed + speedFactor * (maxSpeed - minSpeed);    // [min, max]
+
+        // Update progress value
+        result += dynamicSpeed * qMin(1.0, remaining);
+    }
+    return result;
+}
+
+void XQCircularLoadingIndicator::_JoinGroup(XQCircularLoadingIndicatorGroup *group) {
+    {
+        // shortest way round, the offset decays to zero in _Progress()
+        QMutexLocker locker(&m_guard->mutex);
+        m_groupOffset.store(std::remainder(GetCurrentValue() - group->GetCurrentValue(), m_circularDegree), std::memory_order_relaxed);
+        m_group = group;
+    }
+    _UpdateFrameKey();
+    update();
+}
+
+void XQCircularLoadingIndicator::_LeaveGroup() {
+    m_group->_KeyChanged(m_frameKey, QByteArray());
+    m_frameKey.clear();
+
+    // m_currentValue already holds the phase we were drawn at, continue from it
+    QMutexLocker locker(&m_guard->mutex);
+    m_group = nullptr;
+    m_groupOffset.store(0, std::memory_order_relaxed);
+}
+
+void XQCircularLoadingIndicator::_UpdateFrameKey() {
+    if (m_group == nullptr) return;
+
+    QByteArray key;
+    QDataStream stream(&key, QIODevice::WriteOnly);
+    stream << size() << m_layout.devicePixelRatio << m_layout.arc << m_layout.penWidth << static_cast<int>(m_style) << m_segmentSize
+           << m_progressRoundedCap << m_tail << m_progressColor << m_enableBg << m_bgColor << m_enableText << m_cached << m_lowDamage
+           << m_lowDamageStep << m_lowDamageAntialiasing << static_cast<int>(GetDetail());
+    if (m_enableText) stream << m_staticText.text() << m_textFont.toString() << m_textPos << m_textColor;
+
+    m_group->_KeyChanged(m_frameKey, key);
+    m_frameKey = key;
+}
+
+double XQCircularLoadingIndicator::_Quantize(const double &value) const {
+    double step = 0;
+    auto detail = m_detail.load(std::memory_order_relaxed);
+    if (detail == Detail::Tiny) {
+        step = TinyDetailStep;  // fixed, the sprite only holds these phases
+    } else {
+        if (m_lowDamage) step = m_lowDamageStep;
+        if (detail == Detail::Small) step = qMax(step, static_cast<double>(SmallDetailStep));
+    }
+    if (step <= 0) return value;
+    return std::floor(value / step) * step;
+}
+
+int XQCircularLoadingIndicator::_TickInterval() const {
+    auto interval = m_policy->GetTickInterval();
+    if (m_lowDamage) interval = qMax(interval, static_cast<int>(LowDamageTickInterval));
+    switch (m_detail.load(std::memory_order_relaxed)) {
+        case Detail::Full:
+            break;
+        case Detail::Small:
+            interval = qMax(interval, static_cast<int>(SmallDetailTickInterval));
+            break;
+        case Detail::Tiny:
+            interval = qMax(interval, static_cast<int>(TinyDetailTickInterval));
+            break;
+    }
+    return interval;
+}
+
+QRect XQCircularLoadingIndicator::_DirtyRect(const double &value) const {
+    auto start = -fmod(value + 270, m_circularDegree);
+    double span = m_segmentSize;
+    if (m_style == Style::Dots) span = qMax(span, 360.0 / Styles::Dots::Count * (Styles::Dots::Trail - 1));
+    if (m_style == Style::Bars) span = qMax(span, 360.0 / Styles::Bars::Count * (Styles::Bars::Trail - 1));
+
+    // sample the ring every 10 degrees at the outer and the bars' inner radius
+    auto rect = m_layout.arc;
+    auto left = rect.right(), right = rect.left(), top = rect.bottom(), bottom = rect.top();
+    auto include = [&](const double &angle) {
+        auto radians = angle * M_PI / 180.0;
+        for (auto scale : {1.0, 0.55}) {
+            auto x = rect.center().x() + std::cos(radians) * rect.width() / 2 * scale;
+            auto y = rect.center().y() - std::sin(radians) * rect.height() / 2 * scale;
+            left = qMin(left, x);
+            right = qMax(right, x);
+            top = qMin(top, y);
+            bottom = qMax(bottom, y);
+        }
+    };
+    for (double offset = 0; offset < span; offset += 10.0) include(start + offset);
+    include(start + span);
+
+    // the inner DualArc ring turns the other way
+    if (m_style == Style::DualArc) {
+        for (double offset = 0; offset < span; offset += 10.0) include(180.0 - start - offset);
+        include(180.0 - start - span);
+    }
+
+    // pen width, round caps and the chord error of the sampling
+    auto margin = m_layout.penWidth + 2;
+    return QRectF(QPointF(left, top), QPointF(right, bottom)).adjusted(-margin, -margin, margin, margin).toAlignedRect();
+}
+
+void XQCircularLoadingIndicator::_PrepareText() {
+    if (!m_enableText) return;
+
+    // centered in the same frame the label used to be drawn into with Qt::AlignCenter
+    auto rect = QRectF(m_layout.frame);
+    auto available = qMax(0, qMin(m_width, m_height) - 2 * m_progressWidth);
+
+    m_textFont = this->font();
+    if (m_textAutoFit && available > 0) {
+        QFontMetricsF metrics(m_textFont);
+        auto advance = metrics.horizontalAdvance(m_text);
+        if (advance > available) {
+            // only shrink, never grow past the widget font; elide handles the rest
+            auto factor = available / advance;
+            if (m_textFont.pointSizeF() > 0)
+                m_textFont.setPointSizeF(qMax(6.0, m_textFont.pointSizeF() * factor));
+            else
+                m_textFont.setPixelSize(qMax(8, static_cast<int>(m_textFont.pixelSize() * factor)));
+        }
+    }
+
+    QFontMetricsF metrics(m_textFont);
+    auto text = m_textElide ? metrics.elidedText(m_text, ::Qt::ElideRight, available) : m_text;
+    m_staticText.setText(text);
+    m_staticText.prepare(QTransform(), m_textFont);
+
+    auto textSize = m_staticText.size();
+    m_textPos = QPointF(rect.center().x() - textSize.width() / 2, rect.center().y() - textSize.height() / 2);
+}
+
+void XQCircularLoadingIndicator::_UpdateLayout() {
+    auto dpr = devicePixelRatioF();
     auto margin = m_progressWidth / 2;
-    auto pnend = fmod(m_currentValue + 270, m_circularDegree);
-    auto x = this->m_marginX + margin;
-    auto y = this->m_marginY + margin;
+    m_layout.frame = QRect(std::abs(m_marginX - margin), std::abs(m_marginY - margin), m_width, m_height);
+    m_layout.devicePixelRatio = dpr;
+
+    // snap the ring to the device pixel grid: a pen covering an odd number of
+    // device pixels is centered on pixel centers, an even one on pixel edges,
+    // so fractional scale factors don't smear the stroke over partial pixels
+    auto devicePen = qMax(1, qRound(m_progressWidth * dpr));
+    auto offset = (devicePen % 2) ? 0.5 : 0.0;
+    auto snap = [dpr, offset](const double &value) { return (std::floor(value * dpr) + offset) / dpr; };
+    auto x = snap(m_marginX + margin);
+    auto y = snap(m_marginY + margin);
+    auto width = qRound((m_width - m_progressWidth) * dpr) / dpr;
+    auto height = qRound((m_height - m_progressWidth) * dpr) / dpr;
+    m_layout.arc = QRectF(x, y, width, height);
+    m_layout.penWidth = devicePen / dpr;
+
+    // level of detail from the rendered size, a 16 px spinner on a 2x screen
+    // has as many pixels as a 32 px one on a 1x screen
+    auto pixels = qMin(m_width, m_height) * dpr;
+    auto detail = pixels < m_tinyDetailSize ? Detail::Tiny : pixels < m_smallDetailSize ? Detail::Small : Detail::Full;
+    if (m_detail.exchange(detail, std::memory_order_relaxed) != detail) emit si_DetailChanged(detail);
+    _PrepareStyle();
+}
 
-    painter.setRenderHint(QPainter::Antialiasing);
+Styles::Params XQCircularLoadingIndicator::_StyleParams() const {
+    Styles::Params params;
+    params.rect = m_layout.arc;
+    params.penWidth = m_layout.penWidth;
+    params.color = m_progressColor;
+    params.bgColor = m_bgColor;
+    params.roundedCap = m_progressRoundedCap && GetDetail() == Detail::Full;  // a round cap is a pixel or two when small
+    params.flatCap = GetDetail() != Detail::Full;  // neither would a square one, it only lengthens the segment
+    params.segmentSize = m_segmentSize;
+    params.tail = m_tail;
+    params.devicePixelRatio = m_layout.devicePixelRatio;
+    params.texture = m_cached;
+    return params;
+}
+
+void XQCircularLoadingIndicator::_PrepareStyle() {
+    m_cached = _CacheFits(_EstimateCacheBytes());
+    auto params = _StyleParams();
+
+    switch (m_style) {
+        case Style::Arc:
+            Styles::Arc::Prepare(m_styleGeometry.arc, params);
+            break;
+        case Style::DualArc:
+            Styles::DualArc::Prepare(m_styleGeometry.dualArc, params);
+            break;
+        case Style::Dots:
+            Styles::Dots::Prepare(m_styleGeometry.dots, params);
+            break;
+        case Style::Bars:
+            Styles::Bars::Prepare(m_styleGeometry.bars, params);
+            break;
+    }
+    _AccountCaches();
+    _UpdateFrameKey();
+    _PublishSnapshot();
+}
 
-    // create rect
-    auto rect = QRect(std::abs(m_marginX - margin), std::abs(m_marginY - margin), m_width, m_height);
-    painter.setPen(::Qt::NoPen);
-    painter.drawRect(rect);
+void XQCircularLoadingIndicator::_PrepareTextures() {
+    auto params = _StyleParams();
+
+    switch (m_style) {
+        case Style::Arc:
+            Styles::Arc::PrepareTexture(m_styleGeometry.arc, params);
+            break;
+        case Style::DualArc:
+            Styles::DualArc::PrepareTexture(m_styleGeometry.dualArc, params);
+            break;
+        case Style::Dots:
+            Styles::Dots::PrepareTexture(m_styleGeometry.dots, params);
+            break;
+        case Style::Bars:
+            Styles::Bars::PrepareTexture(m_styleGeometry.bars, params);
+            break;
+    }
+}
 
-    // pen
-    auto pen = QPen();
-    pen.setWidth(this->m_progressWidth);
-    pen.setColor(this->m_progressColor);
+template <typename S>
+void XQCircularLoadingIndicator::_DrawBackground(QPainter &painter, const typename S::Geometry &geometry) {
+    S::DrawBackground(painter, geometry);
+}
 
-    // bg pen
-    auto penny = QPen();
-    penny.setWidth(this->m_progressWidth);
-    penny.setColor(this->m_bgColor);
+template <typename S>
+void XQCircularLoadingIndicator::_DrawProgress(QPainter &painter, const typename S::Geometry &geometry, const double &value, const bool &determinate) {
+    if (determinate) {
+        // clockwise from 12 o'clock, proportional to the value within the range
+        auto fraction = static_cast<double>(m_progressValue - m_progressMinimum) / (m_progressMaximum - m_progressMinimum);
+        S::Draw(painter, geometry, 90.0, -fraction * m_circularDegree, false);
+    } else {
+        auto pnend = fmod(value + 270, m_circularDegree);
+        S::Draw(painter, geometry, -pnend, m_segmentSize, true);
+    }
+}
 
-    // text pen
-    auto textPen = QPen();
-    textPen.setColor(this->m_textColor);
+void XQCircularLoadingIndicator::_DrawMoving(QPainter &painter, const double &value, const bool &determinate) {
+    // one style dispatch per frame
+    switch (m_style) {
+        case Style::Arc:
+            _DrawProgress<Styles::Arc>(painter, m_styleGeometry.arc, value, determinate);
+            break;
+        case Style::DualArc:
+            _DrawProgress<Styles::DualArc>(painter, m_styleGeometry.dualArc, value, determinate);
+            break;
+        case Style::Dots:
+            _DrawProgress<Styles::Dots>(painter, m_styleGeometry.dots, value, determinate);
+            break;
+        case Style::Bars:
+            _DrawProgress<Styles::Bars>(painter, m_styleGeometry.bars, value, determinate);
+            break;
+    }
+}
 
-    // set round cap
-    if (this->m_progressRoundedCap) {
-        pen.setCapStyle(::Qt::RoundCap);
-        penny.setCapStyle(::Qt::RoundCap);
+void XQCircularLoadingIndicator::_RebuildCaches() {
+    XQCircularLoadingIndicatorTrace::Scope trace("RebuildCaches", this);
+    m_resizeTimer.stop();
+    _PrepareText();
+    _PrepareStyle();  // picks up color and cap changes
+    _PrepareTextures();
+    m_layerLayout = m_layout;
+    m_layer = QPixmap();
+
+    // background ring and label only change with the configuration, not per
+    // frame; allocated in device pixels so it stays sharp on high-DPI screens
+    if (m_cached && (m_enableBg || m_enableText)) {
+        auto dpr = m_layout.devicePixelRatio;
+        m_layer = QPixmap(size() * dpr);
+        m_layer.setDevicePixelRatio(dpr);
+        m_layer.fill(::Qt::transparent);
+        QPainter painter(&m_layer);
+        painter.setRenderHint(QPainter::Antialiasing);
+        _DrawStatic(painter);
     }
 
+    // every phase of the Tiny detail, including the static layer
+    m_sprite = QPixmap();
+    if (m_cached && GetDetail() == Detail::Tiny) {
+        auto dpr = m_layout.devicePixelRatio;
+        auto frames = m_circularDegree / TinyDetailStep;
+        m_sprite = QPixmap(QSize(width() * frames, height()) * dpr);
+        m_sprite.setDevicePixelRatio(dpr);
+        m_sprite.fill(::Qt::transparent);
+        QPainter painter(&m_sprite);
+        painter.setRenderHint(QPainter::Antialiasing);
+        for (int frame = 0; frame < frames; ++frame) {
+            painter.save();
+            painter.translate(width() * frame, 0);
+            painter.setClipRect(rect());
+            _DrawStatic(painter);
+            _DrawMoving(painter, frame * TinyDetailStep, false);  // the sprite only serves the trail
+            painter.restore();
+        }
+    }
+
+    // the animation thread can't read the pixmap
+    m_layerImage = m_threadedRendering && !m_layer.isNull() ? m_layer.toImage() : QImage();
+
+    _AccountCaches();
+    _PublishSnapshot();
+}
+
+void XQCircularLoadingIndicator::_DrawStatic(QPainter &painter) {
     if (this->m_enableBg) {
-        painter.setPen(penny);
-        painter.drawArc(x, y, pnwidth, pnheight, -m_circularDegree * 16, m_circularDegree * 16);
+        switch (m_style) {
+            case Style::Arc:
+                _DrawBackground<Styles::Arc>(painter, m_styleGeometry.arc);
+                break;
+            case Style::DualArc:
+                _DrawBackground<Styles::DualArc>(painter, m_styleGeometry.dualArc);
+                break;
+            case Style::Dots:
+                _DrawBackground<Styles::Dots>(painter, m_styleGeometry.dots);
+                break;
+            case Style::Bars:
+                _DrawBackground<Styles::Bars>(painter, m_styleGeometry.bars);
+                break;
+        }
     }
 
     if (this->m_enableText) {
+        // text pen
+        auto textPen = QPen();
+        textPen.setColor(this->m_textColor);
+
         painter.setPen(textPen);
-        painter.drawText(rect, ::Qt::AlignCenter, this->m_text);
+        painter.setFont(m_textFont);
+        painter.drawStaticText(m_textPos, m_staticText);
+    }
+}
+
+qint64 XQCircularLoadingIndicator::_EstimateCacheBytes() const {
+    auto area = m_layout.devicePixelRatio * m_layout.devicePixelRatio * 4;  // ARGB32 bytes per logical pixel
+    qint64 bytes = 0;
+    if (m_enableBg || m_enableText) bytes += static_cast<qint64>(width() * height() * area);
+    if (m_threadedRendering) bytes += static_cast<qint64>(width() * height() * area) * 4;  // layer copy and three frames
+    if (GetDetail() == Detail::Tiny) bytes += static_cast<qint64>(width() * height() * area) * (m_circularDegree / TinyDetailStep);
+    if (m_tail && (m_style == Style::Arc || m_style == Style::DualArc)) {
+        auto bounds = m_layout.arc.adjusted(-m_layout.penWidth, -m_layout.penWidth, m_layout.penWidth, m_layout.penWidth);
+        bytes += static_cast<qint64>(bounds.width() * bounds.height() * area) * (m_style == Style::DualArc ? 2 : 1);
+    }
+    return bytes;
+}
+
+bool XQCircularLoadingIndicator::_CacheFits(const qint64 &bytes) const {
+    if (m_cacheLimit > 0 && bytes > m_cacheLimit) return false;
+
+    // our own current caches are replaced, not added to
+    auto global = GetGlobalCacheLimit();
+    return global <= 0 || GetTotalCacheBytes() - m_cacheBytes + bytes <= global;
+}
+
+void XQCircularLoadingIndicator::_AccountCaches() {
+    qint64 bytes = 0;
+    if (!m_layer.isNull()) bytes += static_cast<qint64>(m_layer.width()) * m_layer.height() * m_layer.depth() / 8;
+    if (!m_sprite.isNull()) bytes += static_cast<qint64>(m_sprite.width()) * m_sprite.height() * m_sprite.depth() / 8;
+    if (!m_layerImage.isNull()) bytes += m_layerImage.sizeInBytes();
+
+    // three frames between the animation thread and paintEvent
+    if (m_threadedRendering) bytes += static_cast<qint64>(width() * height() * m_layout.devicePixelRatio * m_layout.devicePixelRatio * 4) * 3;
+
+    switch (m_style) {
+        case Style::Arc:
+            bytes += Styles::Arc::Bytes(m_styleGeometry.arc);
+            break;
+        case Style::DualArc:
+            bytes += Styles::DualArc::Bytes(m_styleGeometry.dualArc);
+            break;
+        case Style::Dots:
+            bytes += Styles::Dots::Bytes(m_styleGeometry.dots);
+            break;
+        case Style::Bars:
+            bytes += Styles::Bars::Bytes(m_styleGeometry.bars);
+            break;
+    }
+
+    // glyph indices, positions and the string, approximately
+    if (m_enableText) bytes += m_staticText.text().size() * 32;
+
+    // QGraphicsDropShadowEffect keeps a blurred copy of the widget
+    if (m_shadow) bytes += static_cast<qint64>(width() * height() * m_layout.devicePixelRatio * m_layout.devicePixelRatio * 4);
+
+    totalCacheBytes.fetch_add(bytes - m_cacheBytes, std::memory_order_relaxed);
+    m_cacheBytes = bytes;
+}
+
+void XQCircularLoadingIndicator::_PaintFrame(QPainter &painter, const QRect &rect, const double &value) {
+    // tiny indicators blit a pre-rasterized frame, nothing is drawn per frame
+    if (!m_sprite.isNull() && !m_determinate && m_layerLayout.arc == m_layout.arc) {
+        auto frames = m_circularDegree / TinyDetailStep;
+        auto phase = fmod(_Quantize(value), m_circularDegree);
+        if (phase < 0) phase += m_circularDegree;
+        auto index = qRound(phase / TinyDetailStep) % frames;
+        auto ratio = m_layerLayout.devicePixelRatio;
+        auto source = QRectF(QPointF(rect.topLeft()) + QPointF(width() * index, 0), QSizeF(rect.size()));
+        painter.drawPixmap(rect, m_sprite, QRectF(source.topLeft() * ratio, source.size() * ratio).toRect());
+        return;
+    }
+
+    // static layer, stretched from its last geometry while a resize settles
+    if (!m_layer.isNull()) {
+        if (m_layerLayout.arc == m_layout.arc) {
+            // only the damaged part, partial updates are common in low-damage mode
+            auto ratio = m_layerLayout.devicePixelRatio;
+            painter.drawPixmap(rect, m_layer, QRect((QPointF(rect.topLeft()) * ratio).toPoint(), (QSizeF(rect.size()) * ratio).toSize()));
+        } else {
+            auto source = m_layerLayout.arc.adjusted(-m_layerLayout.penWidth, -m_layerLayout.penWidth, m_layerLayout.penWidth, m_layerLayout.penWidth);
+            auto target = m_layout.arc.adjusted(-m_layout.penWidth, -m_layout.penWidth, m_layout.penWidth, m_layout.penWidth);
+            auto ratio = m_layerLayout.devicePixelRatio;  // source rect is in pixmap pixels
+            painter.drawPixmap(target, m_layer, QRectF(source.topLeft() * ratio, source.size() * ratio));
+        }
+    } else if (!m_cached) {
+        _DrawStatic(painter);  // over the cache limit, draw directly
     }
 
     // create arc/circular progress
-    painter.setPen(pen);
-    painter.drawArc(x, y, pnwidth, pnheight, -pnend * 16, m_segmentSize * 16);
+    _DrawMoving(painter, _Quantize(value), m_determinate);
+}
+
+bool XQCircularLoadingIndicator::_PaintShared(QPainter &painter, const QRect &rect) {
+    if (m_group == nullptr || m_determinate || m_groupOffset.load(std::memory_order_relaxed) != 0 || !m_group->_Shared(m_frameKey)) return false;
+
+    // low-damage repaints only cover the old and new segment of our own tick
+    if (m_lowDamage) return false;
+
+    // a stopped member keeps its own frozen phase instead of following the group
+    if (!m_animating) return false;
+
+    // every member paints the group phase of the latest tick, not the phase of
+    // its own last tick, so members ticking in different slots agree
+    qint64 slot;
+    auto value = m_group->_Current(slot);
+    const QPixmap *frame = m_group->_Frame(m_frameKey, slot);
+    if (frame == nullptr) {
+        // first member painting this tick renders the frame for all of them
+        XQCircularLoadingIndicatorTrace::Scope trace("RenderSharedFrame", this);
+        auto dpr = m_layout.devicePixelRatio;
+        auto *target = m_group->_FrameTarget(m_frameKey, slot, size() * dpr, dpr);
+        QPainter framePainter(target);
+        framePainter.setRenderHints(painter.renderHints());
+        _PaintFrame(framePainter, this->rect(), value);
+        framePainter.end();
+        frame = target;
+    }
+
+    auto ratio = frame->devicePixelRatio();
+    painter.drawPixmap(rect, *frame, QRect((QPointF(rect.topLeft()) * ratio).toPoint(), (QSizeF(rect.size()) * ratio).toSize()));
+    return true;
+}
+
+bool XQCircularLoadingIndicator::_PaintRendered(QPainter &painter, const QRect &rect) {
+    if (!m_threadedRendering || !m_animating || m_determinate) return false;
+
+    // take the newest completed image, if the animation thread finished one
+    auto &buffers = *m_buffers;
+    if (buffers.middle.load(std::memory_order_relaxed) & FreshFrame)
+        buffers.front = buffers.middle.exchange(buffers.front, std::memory_order_acq_rel) & ~FreshFrame;
+
+    // rendered from an older configuration, or nothing rendered yet
+    if (buffers.generations[buffers.front] != m_snapshotGeneration) return false;
+
+    const auto &image = buffers.images[buffers.front];
+    auto ratio = image.devicePixelRatio();
+    painter.drawImage(rect, image, QRectF(QPointF(rect.topLeft()) * ratio, QSizeF(rect.size()) * ratio).toRect());
+    return true;
+}
+
+void XQCircularLoadingIndicator::_Render(Buffers &buffers, const Snapshot &snapshot, const double &value, const void *object) {
+    XQCircularLoadingIndicatorTrace::Scope trace("Render", object);
+    auto &image = buffers.images[buffers.back];
+    auto pixels = snapshot.size * snapshot.devicePixelRatio;
+    if (image.size() != pixels) image = QImage(pixels, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(snapshot.devicePixelRatio);
+    image.fill(::Qt::transparent);
+
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing, snapshot.antialiasing);
+    if (!snapshot.layer.isNull()) painter.drawImage(QPointF(0, 0), snapshot.layer);
+
+    auto start = -fmod(value + 270, 360.0);
+    switch (snapshot.style) {
+        case Style::Arc:
+            Styles::Arc::Draw(painter, snapshot.geometry.arc, start, snapshot.segmentSize, true);
+            break;
+        case Style::DualArc:
+            Styles::DualArc::Draw(painter, snapshot.geometry.dualArc, start, snapshot.segmentSize, true);
+            break;
+        case Style::Dots:
+            Styles::Dots::Draw(painter, snapshot.geometry.dots, start, snapshot.segmentSize, true);
+            break;
+        case Style::Bars:
+            Styles::Bars::Draw(painter, snapshot.geometry.bars, start, snapshot.segmentSize, true);
+            break;
+    }
+    painter.end();
+
+    // publish: our back buffer becomes the exchanged one, we continue with
+    // whichever image was exchanged before
+    buffers.generations[buffers.back] = snapshot.generation;
+    buffers.back = buffers.middle.exchange(buffers.back | FreshFrame, std::memory_order_acq_rel) & ~FreshFrame;
+}
+
+void XQCircularLoadingIndicator::_PublishSnapshot() {
+    // every call starts a new generation, so frames of the old configuration
+    // are never blitted, not even while nothing is published
+    std::shared_ptr<const Snapshot> snapshot;
+    ++m_snapshotGeneration;
+
+    // the sprite and uncached rendering stay on the GUI thread, so does a
+    // layer that doesn't match the layout while a resize settles
+    if (m_threadedRendering && m_cached && m_sprite.isNull() && m_layerLayout.arc == m_layout.arc) {
+        auto next = std::make_shared<Snapshot>();
+        next->generation = m_snapshotGeneration;
+        next->size = size();
+        next->devicePixelRatio = m_layout.devicePixelRatio;
+        next->style = m_style;
+        next->geometry = m_styleGeometry;
+        next->layer = m_layerImage;
+        next->segmentSize = m_segmentSize;
+        next->antialiasing = _Antialiasing();
+        snapshot = next;
+    }
+
+    QMutexLocker locker(&m_guard->mutex);
+    m_snapshot = snapshot;
+}
+
+bool XQCircularLoadingIndicator::_Antialiasing() const {
+    // the policy drops antialiasing when all indicators together are over budget
+    auto antialiasing = m_policy->GetRenderTier() == XQCircularLoadingIndicatorPolicy::RenderTier::Full;
+    if (m_lowDamage && !m_lowDamageAntialiasing) antialiasing = false;
+    return antialiasing;
+}
+
+void XQCircularLoadingIndicator::paintEvent(QPaintEvent *event) {
+    XQCircularLoadingIndicatorTrace::Scope trace("Paint", this);
+    QElapsedTimer paintTimer;
+    paintTimer.start();
+
+    // moved to a screen with a different pixel ratio, re-rasterize
+    if (m_layout.devicePixelRatio != devicePixelRatioF()) {
+        _UpdateLayout();
+        _RebuildCaches();
+    }
+
+    QPainter painter(this);
+
+    painter.setRenderHint(QPainter::Antialiasing, _Antialiasing());
+
+    // bytes of the damaged area, to compare the damage rate of the modes
+    auto dpr = devicePixelRatioF();
+    for (const auto &rect : event->region()) m_damagedBytes += static_cast<qint64>(rect.width() * rect.height() * dpr * dpr * 4);
+
+    if (!_PaintRendered(painter, event->rect()) && !_PaintShared(painter, event->rect()))
+        _PaintFrame(painter, event->rect(), m_currentValue.load(std::memory_order_relaxed));
 
     // end
     painter.end();
+    m_policy->ReportPaint(paintTimer.nsecsElapsed());
 }
 
 void XQCircularLoadingIndicator::resizeEvent(QResizeEvent *event) {
+    _UpdateGeometry(event->size());
+    _UpdateLayout();
+
+    // caches are rebuilt once the size settles, until then the last layer is stretched
+    m_resizeTimer.start();
+    update();
+}
+
+void XQCircularLoadingIndicator::_UpdateGeometry(const QSize &eventSize) {
     QSize size;
-    if (event->size().width() > m_width + m_marginX * 2)  // expand
-        size.setWidth(qMax(event->size().width(), m_width + m_marginX * 2));
+    if (eventSize.width() > m_width + m_marginX * 2)  // expand
+        size.setWidth(qMax(eventSize.width(), m_width + m_marginX * 2));
     else  // shrink
-        size.setWidth(qMin(event->size().width(), m_width + m_marginX * 2));
+        size.setWidth(qMin(eventSize.width(), m_width + m_marginX * 2));
 
-    if (event->size().height() > m_height + m_marginY * 2)  // expand
-        size.setHeight(qMax(event->size().height(), m_height + m_marginY * 2));
+    if (eventSize.height() > m_height + m_marginY * 2)  // expand
+        size.setHeight(qMax(eventSize.height(), m_height + m_marginY * 2));
     else  // shrink
-        size.setHeight(qMin(event->size().height(), m_height + m_marginY * 2));
+        size.setHeight(qMin(eventSize.height(), m_height + m_marginY * 2));
 
     if (m_square) {
         this->m_width = qMin(size.width(), size.height());
@@ -473,8 +1617,14 @@ void XQCircularLoadingIndicator::resizeEvent(QResizeEvent *event) {
         this->m_marginX = 0;
         this->m_marginY = 0;
     }
+}
 
-    update();
+void XQCircularLoadingIndicator::changeEvent(QEvent *event) {
+    if (event->type() == QEvent::FontChange) {
+        _RebuildCaches();
+        update();
+    }
+    QWidget::changeEvent(event);
 }
 
 }  // namespace Widgets
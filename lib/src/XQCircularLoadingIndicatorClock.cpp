@@ -0,0 +1,107 @@
+#include "XQCircularLoadingIndicatorClock.hpp"
+
+namespace xaprier {
+namespace Qt {
+namespace Widgets {
+XQCircularLoadingIndicatorClock *XQCircularLoadingIndicatorClock::System() {
+    // never destroyed, threads still winding down at exit may use it
+    static auto *clock = new XQCircularLoadingIndicatorSystemClock();
+    return clock;
+}
+
+void XQCircularLoadingIndicatorClock::Attach() {
+    QMutexLocker locker(&m_attachMutex);
+    m_attachedThreads++;
+}
+
+void XQCircularLoadingIndicatorClock::Detach() {
+    QMutexLocker locker(&m_attachMutex);
+    m_attachedThreads--;
+    m_detached.wakeAll();
+}
+
+void XQCircularLoadingIndicatorClock::WaitDetached() {
+    // wake sleepers so they notice their run flag was cleared
+    Wake();
+    QMutexLocker locker(&m_attachMutex);
+    while (m_attachedThreads > 0) m_detached.wait(&m_attachMutex);
+}
+
+XQCircularLoadingIndicatorSystemClock::XQCircularLoadingIndicatorSystemClock() { m_timer.start(); }
+
+XQCircularLoadingIndicatorSystemClock::~XQCircularLoadingIndicatorSystemClock() { WaitDetached(); }
+
+void XQCircularLoadingIndicatorSystemClock::Sleep(const int &ms) {
+    QMutexLocker locker(&m_mutex);
+    QDeadlineTimer deadline(ms);
+    while (m_wakeups == m_seenWakeups && !deadline.hasExpired()) m_condition.wait(&m_mutex, deadline);
+    m_seenWakeups = m_wakeups;
+}
+
+void XQCircularLoadingIndicatorSystemClock::Wake() {
+    QMutexLocker locker(&m_mutex);
+    m_wakeups++;
+    m_condition.wakeAll();
+}
+
+XQCircularLoadingIndicatorManualClock::~XQCircularLoadingIndicatorManualClock() { WaitDetached(); }
+
+void XQCircularLoadingIndicatorManualClock::Advance(const qint64 &ms) {
+    QMutexLocker locker(&m_mutex);
+    m_now += ms;
+    m_tick.wakeAll();
+    while (!_Settled()) m_settled.wait(&m_mutex);
+}
+
+qint64 XQCircularLoadingIndicatorManualClock::Elapsed() const {
+    QMutexLocker locker(&m_mutex);
+    return m_now;
+}
+
+void XQCircularLoadingIndicatorManualClock::Sleep(const int &ms) {
+    QMutexLocker locker(&m_mutex);
+
+    // woken before it got here, don't park
+    if (m_wakeups != m_seenWakeups) {
+        m_seenWakeups = m_wakeups;
+        return;
+    }
+
+    auto deadline = m_now + qMax(1, ms);
+    auto it = m_sleepers.insert(deadline, 0);
+    m_settled.wakeAll();
+    while (m_wakeups == m_seenWakeups && m_now < deadline) m_tick.wait(&m_mutex);
+    m_seenWakeups = m_wakeups;
+    m_sleepers.erase(it);
+}
+
+void XQCircularLoadingIndicatorManualClock::Wake() {
+    QMutexLocker locker(&m_mutex);
+    m_wakeups++;
+    m_tick.wakeAll();
+}
+
+void XQCircularLoadingIndicatorManualClock::Attach() {
+    XQCircularLoadingIndicatorClock::Attach();
+    QMutexLocker locker(&m_mutex);
+    m_attached++;
+}
+
+void XQCircularLoadingIndicatorManualClock::Detach() {
+    {
+        QMutexLocker locker(&m_mutex);
+        m_attached--;
+        m_settled.wakeAll();
+    }
+    XQCircularLoadingIndicatorClock::Detach();  // last access, the clock may be destroyed right after
+}
+
+bool XQCircularLoadingIndicatorManualClock::_Settled() const {
+    // every attached thread is parked with a deadline still in the future
+    auto parked = std::distance(m_sleepers.upperBound(m_now), m_sleepers.end());
+    return parked >= m_attached;
+}
+
+}  // namespace Widgets
+}  // namespace Qt
+}  // namespace xaprier
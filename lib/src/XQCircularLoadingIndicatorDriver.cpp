@@ -0,0 +1,90 @@
+#include "XQCircularLoadingIndicatorDriver.hpp"
+
+namespace xaprier {
+namespace Qt {
+namespace Widgets {
+QMutex &XQCircularLoadingIndicatorDriver::_Mutex() {
+    // leaked on purpose, a detached thread may outlive static destruction
+    static auto *mutex = new QMutex();
+    return *mutex;
+}
+
+QHash<XQCircularLoadingIndicatorClock *, XQCircularLoadingIndicatorDriver *> &XQCircularLoadingIndicatorDriver::_Drivers() {
+    static auto *drivers = new QHash<XQCircularLoadingIndicatorClock *, XQCircularLoadingIndicatorDriver *>();
+    return *drivers;
+}
+
+void XQCircularLoadingIndicatorDriver::Add(XQCircularLoadingIndicatorClock *clock, const std::shared_ptr<std::atomic<bool>> &running, const Tick &tick,
+                                           const std::function<void()> &finished) {
+    auto task = std::make_shared<Task>();
+    task->running = running;
+    task->tick = tick;
+    task->finished = finished;
+    task->due = clock->Elapsed();  // first tick right away
+
+    QMutexLocker locker(&_Mutex());
+    auto *driver = _Drivers().value(clock);
+    if (driver == nullptr) {
+        driver = new XQCircularLoadingIndicatorDriver(clock);
+        driver->m_tasks.append(task);
+        _Drivers().insert(clock, driver);
+
+        // attached here, the thread detaches as its very last access
+        clock->Attach();
+        std::thread([driver]() { driver->_Run(); }).detach();
+        return;
+    }
+
+    driver->m_tasks.append(task);
+    locker.unlock();
+    clock->Wake();  // the driver may be sleeping towards a later tick
+}
+
+void XQCircularLoadingIndicatorDriver::_Run() {
+    while (true) {
+        QList<std::shared_ptr<Task>> tasks, stopped;
+        {
+            QMutexLocker locker(&_Mutex());
+            for (auto it = m_tasks.begin(); it != m_tasks.end();) {
+                if ((*it)->running->load()) {
+                    ++it;
+                } else {
+                    stopped.append(*it);
+                    it = m_tasks.erase(it);
+                }
+            }
+
+            // a task added after this point starts a new driver
+            if (m_tasks.isEmpty()) _Drivers().remove(m_clock);
+            tasks = m_tasks;
+        }
+        for (const auto &task : stopped) task->finished();
+        if (tasks.isEmpty()) break;
+
+        auto now = m_clock->Elapsed();
+        auto next = now + XQCircularLoadingIndicatorPolicy::MaximumTickInterval;
+        auto dropped = false;
+        for (const auto &task : tasks) {
+            if (task->due <= now) {
+                auto interval = task->tick(now);
+                if (interval < 0) {
+                    task->running->store(false);
+                    dropped = true;
+                    continue;
+                }
+                task->due = now + interval;
+            }
+            next = qMin(next, task->due);
+        }
+
+        // dropped tasks are finished right away, not after the next sleep
+        if (!dropped) m_clock->Sleep(static_cast<int>(qMax<qint64>(0, next - m_clock->Elapsed())));
+    }
+
+    m_clock->Detach();  // the clock may be destroyed right after
+    delete this;
+}
+
+}  // namespace Widgets
+}  // namespace Qt
+}  // namespace xaprier
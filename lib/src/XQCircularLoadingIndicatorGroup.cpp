@@ -0,0 +1,117 @@
+#include "XQCircularLoadingIndicatorGroup.hpp"
+
+#include "XQCircularLoadingIndicator.hpp"
+
+namespace xaprier {
+namespace Qt {
+namespace Widgets {
+XQCircularLoadingIndicatorGroup::XQCircularLoadingIndicatorGroup(QObject *parent) : QObject(parent) {}
+
+XQCircularLoadingIndicatorGroup::~XQCircularLoadingIndicatorGroup() {
+    auto indicators = m_indicators;
+    m_indicators.clear();
+    for (auto *indicator : indicators) indicator->_LeaveGroup();
+
+    // all keys are gone with the members, so are the frames
+    XQCircularLoadingIndicator::totalCacheBytes.fetch_sub(m_frameBytes, std::memory_order_relaxed);
+}
+
+void XQCircularLoadingIndicatorGroup::AddIndicator(XQCircularLoadingIndicator *indicator) {
+    if (indicator == nullptr || m_indicators.contains(indicator)) return;
+    if (indicator->m_group) indicator->m_group->RemoveIndicator(indicator);
+
+    if (m_indicators.isEmpty()) {
+        QMutexLocker locker(&m_mutex);
+        m_value = indicator->GetCurrentValue();
+        m_slot = -1;
+    }
+
+    m_indicators.append(indicator);
+    indicator->_JoinGroup(this);
+    emit si_CountChanged(m_indicators.size());
+}
+
+void XQCircularLoadingIndicatorGroup::RemoveIndicator(XQCircularLoadingIndicator *indicator) {
+    if (!m_indicators.removeOne(indicator)) return;
+
+    indicator->_LeaveGroup();
+    emit si_CountChanged(m_indicators.size());
+}
+
+double XQCircularLoadingIndicatorGroup::GetCurrentValue() const {
+    QMutexLocker locker(&m_mutex);
+    return m_value;
+}
+
+double XQCircularLoadingIndicatorGroup::_Advance(const qint64 &now, const double &minSpeed, const double &maxSpeed) {
+    QMutexLocker locker(&m_mutex);
+
+    // members ticking within the same base tick read the same phase, so their
+    // frames are identical and can be shared
+    auto slot = now - now % XQCircularLoadingIndicatorPolicy::BaseTickInterval;
+
+    // first tick, or resumed after every member was stopped: nobody saw the
+    // phase in between, so don't integrate the gap
+    if (m_slot < 0 || slot - m_slot > MaximumGap) m_slot = slot;
+
+    if (slot > m_slot) {
+        auto ticks = static_cast<double>(slot - m_slot) / XQCircularLoadingIndicatorPolicy::BaseTickInterval;
+        m_value = XQCircularLoadingIndicator::_Integrate(m_value, ticks, minSpeed, maxSpeed);
+        m_slot = slot;
+    }
+    return m_value;
+}
+
+void XQCircularLoadingIndicatorGroup::_KeyChanged(const QByteArray &from, const QByteArray &to) {
+    if (from == to) return;
+
+    if (!from.isEmpty()) {
+        if (--m_keys[from] <= 0) m_keys.remove(from);
+        if (!_Shared(from)) _DropFrame(from);
+    }
+    if (!to.isEmpty()) m_keys[to]++;
+}
+
+double XQCircularLoadingIndicatorGroup::_Current(qint64 &slot) const {
+    QMutexLocker locker(&m_mutex);
+    slot = m_slot;
+    return m_value;
+}
+
+const QPixmap *XQCircularLoadingIndicatorGroup::_Frame(const QByteArray &key, const qint64 &slot) const {
+    auto it = m_frames.constFind(key);
+    if (it == m_frames.constEnd() || it->slot != slot) return nullptr;
+    return &it->pixmap;
+}
+
+QPixmap *XQCircularLoadingIndicatorGroup::_FrameTarget(const QByteArray &key, const qint64 &slot, const QSize &size, const qreal &devicePixelRatio) {
+    auto &frame = m_frames[key];
+    frame.slot = slot;
+
+    // the same pixmap is repainted every tick, only a new size reallocates it
+    if (frame.pixmap.size() != size || frame.pixmap.devicePixelRatio() != devicePixelRatio) {
+        auto before = static_cast<qint64>(frame.pixmap.width()) * frame.pixmap.height() * frame.pixmap.depth() / 8;
+        frame.pixmap = QPixmap(size);
+        frame.pixmap.setDevicePixelRatio(devicePixelRatio);
+        auto after = static_cast<qint64>(frame.pixmap.width()) * frame.pixmap.height() * frame.pixmap.depth() / 8;
+
+        m_frameBytes += after - before;
+        XQCircularLoadingIndicator::totalCacheBytes.fetch_add(after - before, std::memory_order_relaxed);
+    }
+    frame.pixmap.fill(::Qt::transparent);
+    return &frame.pixmap;
+}
+
+void XQCircularLoadingIndicatorGroup::_DropFrame(const QByteArray &key) {
+    auto it = m_frames.find(key);
+    if (it == m_frames.end()) return;
+
+    auto bytes = static_cast<qint64>(it->pixmap.width()) * it->pixmap.height() * it->pixmap.depth() / 8;
+    m_frameBytes -= bytes;
+    XQCircularLoadingIndicator::totalCacheBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    m_frames.erase(it);
+}
+
+}  // namespace Widgets
+}  // namespace Qt
+}  // namespace xaprier
@@ -0,0 +1,109 @@
+#include "XQCircularLoadingIndicatorPolicy.hpp"
+
+namespace xaprier {
+namespace Qt {
+namespace Widgets {
+XQCircularLoadingIndicatorPolicy *XQCircularLoadingIndicatorPolicy::instance = nullptr;
+
+XQCircularLoadingIndicatorPolicy *XQCircularLoadingIndicatorPolicy::Instance() {
+    if (XQCircularLoadingIndicatorPolicy::instance == nullptr)
+        XQCircularLoadingIndicatorPolicy::instance = new XQCircularLoadingIndicatorPolicy(QCoreApplication::instance());
+    return XQCircularLoadingIndicatorPolicy::instance;
+}
+
+XQCircularLoadingIndicatorPolicy::XQCircularLoadingIndicatorPolicy(QObject *parent) : QObject(parent) {
+    m_window.setInterval(WindowInterval);
+    connect(&m_window, &QTimer::timeout, this, &XQCircularLoadingIndicatorPolicy::_Evaluate);
+    connect(this, &QObject::destroyed, []() { XQCircularLoadingIndicatorPolicy::instance = nullptr; });
+}
+
+void XQCircularLoadingIndicatorPolicy::ReportPaint(const qint64 &nsecs) {
+    m_windowPaintNs.fetch_add(nsecs, std::memory_order_relaxed);
+
+    // the window only runs while something is painting, idle apps are not woken up
+    if (m_windowActive.exchange(true, std::memory_order_relaxed)) return;
+    if (QThread::currentThread() == thread())
+        _StartWindow();
+    else
+        QMetaObject::invokeMethod(this, &XQCircularLoadingIndicatorPolicy::_StartWindow, ::Qt::QueuedConnection);
+}
+
+void XQCircularLoadingIndicatorPolicy::_StartWindow() {
+    m_windowClock.start();
+    m_window.start();
+}
+
+void XQCircularLoadingIndicatorPolicy::SetPaintBudget(const double &msPerSecond) {
+    if (msPerSecond <= 0) {
+        qDebug() << QObject::tr(
+            "Paint budget must be greater than zero. Please provide a "
+            "positive value in milliseconds per second.");
+        return;
+    }
+
+    if (m_paintBudget != msPerSecond) {
+        m_paintBudget = msPerSecond;
+        emit si_PaintBudgetChanged(msPerSecond);
+    }
+}
+
+void XQCircularLoadingIndicatorPolicy::SetLowPower(const bool &enable) {
+    if (m_lowPower != enable) {
+        m_lowPower = enable;
+        emit si_LowPowerChanged(enable);
+        if (enable)
+            _Apply(qMax(GetTickInterval(), static_cast<int>(LowPowerTickInterval)), RenderTier::Reduced);
+        else
+            _Apply(BaseTickInterval, RenderTier::Full);  // re-throttled by the next window if still over budget
+    }
+}
+
+void XQCircularLoadingIndicatorPolicy::_Evaluate() {
+    auto elapsed = qMax<qint64>(1, m_windowClock.restart());
+    auto load = (m_windowPaintNs.exchange(0, std::memory_order_relaxed) / 1e6) * (1000.0 / elapsed);  // ms of paint per second
+
+    if (m_measuredLoad != load) {
+        m_measuredLoad = load;
+        emit si_MeasuredLoadChanged(load);
+    }
+
+    // nothing painted during the window, stop measuring until the next paint
+    if (load == 0) {
+        m_window.stop();
+        m_windowActive.store(false, std::memory_order_relaxed);
+        return;
+    }
+
+    auto interval = GetTickInterval();
+    auto tier = m_renderTier;
+    auto floor = m_lowPower ? static_cast<int>(LowPowerTickInterval) : static_cast<int>(BaseTickInterval);
+
+    if (load > m_paintBudget) {
+        // paint cost scales with the tick rate, stretch the interval by the overshoot
+        auto stretched = static_cast<int>(std::ceil(interval * load / m_paintBudget));
+        if (interval >= MaximumTickInterval) tier = RenderTier::Reduced;  // can't slow down further
+        interval = qMin(static_cast<int>(MaximumTickInterval), qMax(stretched, interval + 1));
+    } else if (load < m_paintBudget / 2) {
+        // comfortably under budget, recover gradually (hysteresis avoids oscillation)
+        if (!m_lowPower) tier = RenderTier::Full;
+        interval = qMax(floor, interval / 2);
+    }
+
+    _Apply(interval, tier);
+}
+
+void XQCircularLoadingIndicatorPolicy::_Apply(const int &interval, const RenderTier &tier) {
+    if (GetTickInterval() != interval) {
+        m_tickInterval.store(interval, std::memory_order_relaxed);
+        emit si_TickIntervalChanged(interval);
+    }
+
+    if (m_renderTier != tier) {
+        m_renderTier = tier;
+        emit si_RenderTierChanged(tier);
+    }
+}
+
+}  // namespace Widgets
+}  // namespace Qt
+}  // namespace xaprier
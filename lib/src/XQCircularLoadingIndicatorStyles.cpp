@@ -0,0 +1,240 @@
+#include "XQCircularLoadingIndicatorStyles.hpp"
+
+namespace xaprier {
+namespace Qt {
+namespace Widgets {
+namespace Styles {
+namespace {
+// point on the ring center line at a drawArc() angle
+QPointF PointAt(const QRectF &rect, const double &angle, const double &scale = 1.0) {
+    auto radians = angle * M_PI / 180.0;
+    return QPointF(rect.center().x() + std::cos(radians) * rect.width() / 2 * scale,
+                   rect.center().y() - std::sin(radians) * rect.height() / 2 * scale);
+}
+
+// alpha of a trail position, 255 at the head fading to a quarter at the end
+QColor Faded(QColor color, const int &position, const int &count) {
+    color.setAlphaF(color.alphaF() * (1.0 - 0.75 * position / qMax(1, count - 1)));
+    return color;
+}
+
+// inner ring of DualArc, one and a half pen widths inside the outer one
+Params Inner(const Params &params) {
+    auto inset = params.penWidth * 2;
+    auto inner = params;
+    inner.rect = params.rect.adjusted(inset, inset, -inset, -inset);
+    return inner;
+}
+}  // namespace
+
+double Distance(const double &angle, const double &start, const double &span) {
+    // measured from the head along the direction of the span
+    auto distance = span >= 0 ? std::fmod(angle - start + 720.0, 360.0) : std::fmod(start - angle + 720.0, 360.0);
+    return distance <= std::abs(span) ? distance : -1.0;
+}
+
+void Arc::Prepare(Geometry &geometry, const Params &params) {
+    geometry.rect = params.rect;
+
+    geometry.pen = QPen(params.color);
+    geometry.pen.setWidthF(params.penWidth);
+    geometry.pen.setCapStyle(params.flatCap ? ::Qt::FlatCap : params.roundedCap ? ::Qt::RoundCap : ::Qt::SquareCap);
+
+    geometry.bgPen = geometry.pen;
+    geometry.bgPen.setColor(params.bgColor);
+
+    geometry.tail = params.tail;
+    geometry.textureCurrent = false;
+    if (!params.tail || !params.texture) {
+        geometry.texturePen = QPen();
+        geometry.textureBytes = 0;
+    }
+    if (!params.tail) return;
+
+    // fraction of a turn covered by a round cap, kept opaque on both sides of
+    // the head so the cap ahead of position 0 (wrapping to 1) doesn't vanish
+    auto center = params.rect.center();
+    auto radius = qMax<qreal>(1.0, qMin(params.rect.width(), params.rect.height()) / 2);
+    auto head = qMin(0.1, params.penWidth / 2 / radius / (2 * M_PI));
+    auto end = qBound(head, params.segmentSize / 360.0, 1.0 - head);
+    auto transparent = params.color;
+    transparent.setAlpha(0);
+
+    QConicalGradient gradient(center, 0);
+    gradient.setColorAt(0, params.color);
+    gradient.setColorAt(end, transparent);
+    gradient.setColorAt(1.0 - head, transparent);
+    gradient.setColorAt(1, params.color);
+
+    geometry.gradientPen = geometry.pen;
+    geometry.gradientPen.setBrush(QBrush(gradient));
+}
+
+void Arc::PrepareTexture(Geometry &geometry, const Params &params) {
+    if (!geometry.tail || !params.texture) return;
+
+    // rasterize the gradient once over the ring's bounds, in device pixels
+    auto dpr = params.devicePixelRatio;
+    auto bounds = geometry.rect.adjusted(-params.penWidth, -params.penWidth, params.penWidth, params.penWidth);
+    QImage texture((bounds.size() * dpr).toSize(), QImage::Format_ARGB32_Premultiplied);
+    texture.fill(::Qt::transparent);
+    QPainter painter(&texture);
+    painter.scale(dpr, dpr);
+    painter.translate(-bounds.topLeft());
+    painter.fillRect(bounds, geometry.gradientPen.brush());
+    painter.end();
+
+    geometry.texturePen = geometry.pen;
+    geometry.texturePen.setBrush(QBrush(texture));
+    geometry.textureTransform = QTransform().translate(bounds.x(), bounds.y()).scale(1.0 / dpr, 1.0 / dpr);
+    geometry.textureBytes = texture.sizeInBytes();
+    geometry.textureCurrent = true;
+}
+
+qint64 Arc::Bytes(const Geometry &geometry) { return geometry.textureBytes; }
+
+void Arc::DrawBackground(QPainter &painter, const Geometry &geometry) {
+    painter.setPen(geometry.bgPen);
+    painter.drawArc(geometry.rect, 0, 360 * 16);
+}
+
+void Arc::Draw(QPainter &painter, const Geometry &geometry, const double &start, const double &span, const bool &trail) {
+    if (trail && geometry.tail) {
+        // move the gradient's head to start; a clockwise span mirrors it
+        auto center = geometry.rect.center();
+        QTransform rotation;
+        rotation.translate(center.x(), center.y());
+        rotation.rotate(-start);
+        if (span < 0) rotation.scale(1, -1);
+        rotation.translate(-center.x(), -center.y());
+
+        auto raster = geometry.textureCurrent && painter.paintEngine() && painter.paintEngine()->type() == QPaintEngine::Raster;
+        auto pen = raster ? geometry.texturePen : geometry.gradientPen;
+        auto brush = pen.brush();
+        brush.setTransform(raster ? geometry.textureTransform * rotation : rotation);
+        pen.setBrush(brush);
+        painter.setPen(pen);
+    } else {
+        painter.setPen(geometry.pen);
+    }
+    painter.drawArc(geometry.rect, static_cast<int>(start * 16), static_cast<int>(span * 16));
+}
+
+void DualArc::Prepare(Geometry &geometry, const Params &params) {
+    Arc::Prepare(geometry.outer, params);
+
+    auto inner = Inner(params);
+    geometry.hasInner = inner.rect.width() > params.penWidth && inner.rect.height() > params.penWidth;
+    if (geometry.hasInner) Arc::Prepare(geometry.inner, inner);
+}
+
+void DualArc::PrepareTexture(Geometry &geometry, const Params &params) {
+    Arc::PrepareTexture(geometry.outer, params);
+    if (geometry.hasInner) Arc::PrepareTexture(geometry.inner, Inner(params));
+}
+
+qint64 DualArc::Bytes(const Geometry &geometry) { return Arc::Bytes(geometry.outer) + (geometry.hasInner ? Arc::Bytes(geometry.inner) : 0); }
+
+void DualArc::DrawBackground(QPainter &painter, const Geometry &geometry) {
+    Arc::DrawBackground(painter, geometry.outer);
+    if (geometry.hasInner) Arc::DrawBackground(painter, geometry.inner);
+}
+
+void DualArc::Draw(QPainter &painter, const Geometry &geometry, const double &start, const double &span, const bool &trail) {
+    Arc::Draw(painter, geometry.outer, start, span, trail);
+
+    // mirrored across the vertical axis, so it turns the other way
+    if (trail && geometry.hasInner) Arc::Draw(painter, geometry.inner, 180.0 - start, -span, trail);
+}
+
+void Dots::Prepare(Geometry &geometry, const Params &params) {
+    auto radius = qMax<qreal>(0.5, params.penWidth / 2);
+    geometry.dots.resize(Count);
+    geometry.angles.resize(Count);
+    for (int i = 0; i < Count; i++) {
+        geometry.angles[i] = 90.0 - i * 360.0 / Count;
+        auto center = PointAt(params.rect, geometry.angles[i]);
+        geometry.dots[i] = QRectF(center.x() - radius, center.y() - radius, radius * 2, radius * 2);
+    }
+
+    geometry.ramp.resize(Count);
+    for (int i = 0; i < Count; i++) geometry.ramp[i] = QBrush(Faded(params.color, i, Count));
+    geometry.bgBrush = QBrush(params.bgColor);
+}
+
+// nothing rasterized, dots are cheap to draw directly
+void Dots::PrepareTexture(Geometry &, const Params &) {}
+
+qint64 Dots::Bytes(const Geometry &geometry) {
+    return geometry.dots.size() * sizeof(QRectF) + geometry.angles.size() * sizeof(double) + geometry.ramp.size() * sizeof(QBrush);
+}
+
+void Dots::DrawBackground(QPainter &painter, const Geometry &geometry) {
+    painter.setPen(::Qt::NoPen);
+    painter.setBrush(geometry.bgBrush);
+    for (const auto &dot : geometry.dots) painter.drawEllipse(dot);
+}
+
+void Dots::Draw(QPainter &painter, const Geometry &geometry, const double &start, const double &span, const bool &trail) {
+    constexpr double step = 360.0 / Count;
+    auto range = trail ? qMax(span, step * (Trail - 1)) : span;
+
+    painter.setPen(::Qt::NoPen);
+    for (int i = 0; i < Count; i++) {
+        auto distance = Distance(geometry.angles[i], start, range);
+        if (distance < 0) continue;
+        auto position = trail ? qMin(Count - 1, static_cast<int>(distance / step)) : 0;
+        painter.setBrush(geometry.ramp[position]);
+        painter.drawEllipse(geometry.dots[i]);
+    }
+}
+
+void Bars::Prepare(Geometry &geometry, const Params &params) {
+    geometry.bars.resize(Count);
+    geometry.angles.resize(Count);
+    for (int i = 0; i < Count; i++) {
+        geometry.angles[i] = 90.0 - i * 360.0 / Count;
+        geometry.bars[i] = QLineF(PointAt(params.rect, geometry.angles[i], 0.55), PointAt(params.rect, geometry.angles[i]));
+    }
+
+    QPen pen;
+    pen.setWidthF(qMax<qreal>(1.0, params.penWidth / 2));
+    pen.setCapStyle(params.roundedCap && !params.flatCap ? ::Qt::RoundCap : ::Qt::FlatCap);
+
+    geometry.ramp.resize(Count);
+    for (int i = 0; i < Count; i++) {
+        geometry.ramp[i] = pen;
+        geometry.ramp[i].setColor(Faded(params.color, i, Count));
+    }
+    geometry.bgPen = pen;
+    geometry.bgPen.setColor(params.bgColor);
+}
+
+void Bars::PrepareTexture(Geometry &, const Params &) {}
+
+qint64 Bars::Bytes(const Geometry &geometry) {
+    return geometry.bars.size() * sizeof(QLineF) + geometry.angles.size() * sizeof(double) + geometry.ramp.size() * sizeof(QPen);
+}
+
+void Bars::DrawBackground(QPainter &painter, const Geometry &geometry) {
+    painter.setPen(geometry.bgPen);
+    painter.drawLines(geometry.bars);
+}
+
+void Bars::Draw(QPainter &painter, const Geometry &geometry, const double &start, const double &span, const bool &trail) {
+    constexpr double step = 360.0 / Count;
+    auto range = trail ? qMax(span, step * (Trail - 1)) : span;
+
+    for (int i = 0; i < Count; i++) {
+        auto distance = Distance(geometry.angles[i], start, range);
+        if (distance < 0) continue;
+        auto position = trail ? qMin(Count - 1, static_cast<int>(distance / step)) : 0;
+        painter.setPen(geometry.ramp[position]);
+        painter.drawLine(geometry.bars[i]);
+    }
+}
+
+}  // namespace Styles
+}  // namespace Widgets
+}  // namespace Qt
+}  // namespace xaprier
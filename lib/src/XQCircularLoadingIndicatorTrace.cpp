@@ -0,0 +1,141 @@
+#include "XQCircularLoadingIndicatorTrace.hpp"
+
+#if defined(Q_OS_WIN)
+#define NOMINMAX
+#include <windows.h>
+#elif defined(Q_OS_LINUX)
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(Q_OS_DARWIN)
+#include <pthread.h>
+#endif
+
+namespace xaprier {
+namespace Qt {
+namespace Widgets {
+std::atomic<bool> XQCircularLoadingIndicatorTrace::enabled{false};
+QMutex XQCircularLoadingIndicatorTrace::registryMutex;
+std::vector<std::unique_ptr<XQCircularLoadingIndicatorTrace::Buffer>> XQCircularLoadingIndicatorTrace::registry;
+
+namespace {
+QString exitPath;
+
+void FlushAtExit() {
+    if (!exitPath.isEmpty()) XQCircularLoadingIndicatorTrace::Flush(exitPath);
+}
+
+// XQ_INDICATOR_TRACE=<path> enables tracing for the whole run
+struct EnvironmentSetup {
+    EnvironmentSetup() {
+        exitPath = qEnvironmentVariable("XQ_INDICATOR_TRACE");
+        if (exitPath.isEmpty()) return;
+        XQCircularLoadingIndicatorTrace::SetEnabled(true);
+        qAddPostRoutine(FlushAtExit);
+    }
+} environmentSetup;
+}  // namespace
+
+void XQCircularLoadingIndicatorTrace::SetEnabled(const bool &enable) {
+    enabled.store(enable, std::memory_order_relaxed);
+}
+
+qint64 XQCircularLoadingIndicatorTrace::_Now() {
+    // steady_clock is CLOCK_MONOTONIC on Linux, the clock Perfetto and Chrome
+    // record with, so no epoch of our own
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+qint64 XQCircularLoadingIndicatorTrace::_ThreadId() {
+#if defined(Q_OS_WIN)
+    return static_cast<qint64>(GetCurrentThreadId());
+#elif defined(Q_OS_LINUX)
+    return static_cast<qint64>(syscall(SYS_gettid));
+#elif defined(Q_OS_DARWIN)
+    quint64 id = 0;
+    pthread_threadid_np(nullptr, &id);
+    return static_cast<qint64>(id);
+#else
+    return static_cast<qint64>(reinterpret_cast<quintptr>(QThread::currentThreadId()));
+#endif
+}
+
+XQCircularLoadingIndicatorTrace::Buffer *XQCircularLoadingIndicatorTrace::_ThreadBuffer() {
+    thread_local Owner owner;
+    auto *&buffer = owner.buffer;
+    if (buffer == nullptr) {
+        auto created = std::make_unique<Buffer>();
+        auto *thread = QThread::currentThread();
+        auto isMain = QCoreApplication::instance() && thread == QCoreApplication::instance()->thread();
+
+        created->tid = _ThreadId();
+
+        QMutexLocker locker(&registryMutex);
+        created->threadName = isMain ? QByteArray("GUI thread") : QByteArray("indicator worker ") + QByteArray::number(created->tid);
+        buffer = created.get();
+        registry.push_back(std::move(created));
+    }
+    return buffer;
+}
+
+void XQCircularLoadingIndicatorTrace::Record(const char *name, const char &phase, const void *object) {
+    auto *buffer = _ThreadBuffer();
+    auto head = buffer->head.load(std::memory_order_relaxed);
+    auto tail = buffer->tail.load(std::memory_order_acquire);
+    if (head - tail >= Buffer::Capacity) {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer->events[head % Buffer::Capacity] = Event{name, phase, _Now(), object};
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+bool XQCircularLoadingIndicatorTrace::Flush(const QString &path) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qDebug() << QObject::tr("Cannot open trace file %1 for writing.").arg(path);
+        return false;
+    }
+
+    auto pid = QByteArray::number(QCoreApplication::applicationPid());
+    QByteArray json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    auto append = [&json, &first](const QByteArray &event) {
+        if (!first) json += ",\n";
+        json += event;
+        first = false;
+    };
+
+    QMutexLocker locker(&registryMutex);
+    for (auto &buffer : registry) {
+        // read before draining, a dead thread has recorded its last event
+        auto dead = !buffer->alive.load(std::memory_order_acquire);
+        auto tid = QByteArray::number(buffer->tid);
+        append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" + pid + ",\"tid\":" + tid + ",\"args\":{\"name\":\"" + buffer->threadName + "\"}}");
+
+        auto tail = buffer->tail.load(std::memory_order_relaxed);
+        auto head = buffer->head.load(std::memory_order_acquire);
+        for (auto i = tail; i != head; i++) {
+            const auto &event = buffer->events[i % Buffer::Capacity];
+            auto object = QByteArray::number(reinterpret_cast<quintptr>(event.object), 16);
+            QByteArray entry = "{\"name\":\"" + QByteArray(event.name) + "\",\"cat\":\"indicator\",\"ph\":\"" + QByteArray(1, event.phase) +
+                               "\",\"ts\":" + QByteArray::number(event.timestamp / 1000.0, 'f', 3) + ",\"pid\":" + pid + ",\"tid\":" + tid;
+            if (event.phase == 'i') entry += ",\"s\":\"t\"";
+            entry += ",\"args\":{\"indicator\":\"0x" + object + "\"}}";
+            append(entry);
+        }
+        buffer->tail.store(head, std::memory_order_release);
+
+        auto dropped = buffer->dropped.exchange(0, std::memory_order_relaxed);
+        if (dropped > 0) qDebug() << QObject::tr("Trace buffer of %1 dropped %2 events.").arg(QString(buffer->threadName)).arg(dropped);
+        if (dead) buffer.reset();
+    }
+    registry.erase(std::remove(registry.begin(), registry.end(), nullptr), registry.end());
+    json += "]}\n";
+
+    return file.write(json) == json.size();
+}
+
+}  // namespace Widgets
+}  // namespace Qt
+}  // namespace xaprier
@@ -0,0 +1,170 @@
+#include "XQCircularLoadingIndicatorAnimationTest.hpp"
+
+using xaprier::Qt::Widgets::XQCircularLoadingIndicator;
+using xaprier::Qt::Widgets::XQCircularLoadingIndicatorManualClock;
+using xaprier::Qt::Widgets::XQCircularLoadingIndicatorPolicy;
+
+bool XQCircularLoadingIndicatorAnimationTest::_Start(XQCircularLoadingIndicator &indicator, XQCircularLoadingIndicatorManualClock &clock) {
+    indicator.SetClock(&clock);
+    indicator.SetLowDamage(false);  // no step quantization, no tick stretching
+    indicator.Start();
+    clock.Advance(0);  // returns once the thread is parked on its first sleep
+    return indicator.GetRunning();
+}
+
+bool XQCircularLoadingIndicatorAnimationTest::_Stop(XQCircularLoadingIndicator &indicator) {
+    QSignalSpy stopped(&indicator, &XQCircularLoadingIndicator::si_Stopped);
+    indicator.Stop();
+    return (stopped.count() == 1 || stopped.wait(5000)) && !indicator.GetRunning();
+}
+
+void XQCircularLoadingIndicatorAnimationTest::PhaseFollowsVirtualTime() {
+    XQCircularLoadingIndicatorManualClock clock;
+    XQCircularLoadingIndicator indicator;
+    QVERIFY(_Start(indicator, clock));
+
+    // nothing moves without virtual time
+    QCOMPARE(indicator.GetCurrentValue(), 0.0);
+    clock.Advance(0);
+    QCOMPARE(indicator.GetCurrentValue(), 0.0);
+
+    // one second of ticks at 1..3 degrees each
+    auto ticks = 1000 / XQCircularLoadingIndicatorPolicy::BaseTickInterval;
+    clock.Advance(1000);
+    QVERIFY(indicator.GetCurrentValue() >= ticks * indicator.GetMinimumSpeed());
+    QVERIFY(indicator.GetCurrentValue() <= ticks * indicator.GetMaximumSpeed());
+
+    QVERIFY(_Stop(indicator));
+}
+
+void XQCircularLoadingIndicatorAnimationTest::SpeedStaysWithinBounds_data() {
+    QTest::addColumn<double>("minimum");
+    QTest::addColumn<double>("maximum");
+
+    QTest::newRow("default") << 1.0 << 3.0;
+    QTest::newRow("constant") << 2.0 << 2.0;
+    QTest::newRow("slow") << 0.5 << 0.75;
+    QTest::newRow("fast") << 4.0 << 9.0;
+}
+
+void XQCircularLoadingIndicatorAnimationTest::SpeedStaysWithinBounds() {
+    QFETCH(double, minimum);
+    QFETCH(double, maximum);
+
+    XQCircularLoadingIndicatorManualClock clock;
+    XQCircularLoadingIndicator indicator;
+    indicator.SetMinimumSpeed(0);  // the setters reject inverted ranges
+    indicator.SetMaximumSpeed(maximum);
+    indicator.SetMinimumSpeed(minimum);
+    QCOMPARE(indicator.GetMinimumSpeed(), minimum);
+    QCOMPARE(indicator.GetMaximumSpeed(), maximum);
+    QVERIFY(_Start(indicator, clock));
+
+    // one wake-up per step, whatever interval the policy currently uses
+    auto interval = XQCircularLoadingIndicatorPolicy::Instance()->GetTickInterval();
+    auto ticks = static_cast<double>(interval) / XQCircularLoadingIndicatorPolicy::BaseTickInterval;
+    for (int step = 0; step < 200; step++) {
+        auto before = indicator.GetCurrentValue();
+        clock.Advance(interval);
+        auto delta = indicator.GetCurrentValue() - before;
+        QVERIFY2(delta >= minimum * ticks - 1e-9, qPrintable(QString("step %1 moved %2").arg(step).arg(delta)));
+        QVERIFY2(delta <= maximum * ticks + 1e-9, qPrintable(QString("step %1 moved %2").arg(step).arg(delta)));
+    }
+
+    QVERIFY(_Stop(indicator));
+}
+
+void XQCircularLoadingIndicatorAnimationTest::PhaseDoesNotDependOnSlicing() {
+    XQCircularLoadingIndicatorManualClock wholeClock, slicedClock;
+    XQCircularLoadingIndicator whole, sliced;
+    QVERIFY(_Start(whole, wholeClock));
+    QVERIFY(_Start(sliced, slicedClock));
+
+    wholeClock.Advance(500);
+    for (int i = 0; i < 50; i++) slicedClock.Advance(10);
+    QCOMPARE(sliced.GetCurrentValue(), whole.GetCurrentValue());
+
+    QVERIFY(_Stop(whole));
+    QVERIFY(_Stop(sliced));
+}
+
+void XQCircularLoadingIndicatorAnimationTest::StopFreezesPhase() {
+    XQCircularLoadingIndicatorManualClock clock;
+    XQCircularLoadingIndicator indicator;
+    QVERIFY(_Start(indicator, clock));
+    clock.Advance(250);
+    QVERIFY(_Stop(indicator));
+
+    auto stopped = indicator.GetCurrentValue();
+    QVERIFY(stopped > 0);
+    clock.Advance(1000);
+    QCOMPARE(indicator.GetCurrentValue(), stopped);
+}
+
+void XQCircularLoadingIndicatorAnimationTest::RestartContinuesPhase() {
+    XQCircularLoadingIndicatorManualClock clock;
+    XQCircularLoadingIndicator indicator;
+    QVERIFY(_Start(indicator, clock));
+    clock.Advance(250);
+    QVERIFY(_Stop(indicator));
+    auto stopped = indicator.GetCurrentValue();
+
+    // the time spent stopped is not integrated
+    clock.Advance(5000);
+    QVERIFY(_Start(indicator, clock));
+    QCOMPARE(indicator.GetCurrentValue(), stopped);
+    clock.Advance(10);
+    QVERIFY(indicator.GetCurrentValue() > stopped);
+    QVERIFY(indicator.GetCurrentValue() <= stopped + indicator.GetMaximumSpeed());
+
+    // a second Start() keeps the running animation
+    indicator.Start();
+    QVERIFY(indicator.GetRunning());
+    QVERIFY(_Stop(indicator));
+}
+
+void XQCircularLoadingIndicatorAnimationTest::StopWithinShowDelaySpawnsNothing() {
+    XQCircularLoadingIndicatorManualClock clock;
+    XQCircularLoadingIndicator indicator;
+    indicator.SetClock(&clock);
+    indicator.SetShowDelay(60000);
+
+    QSignalSpy stopped(&indicator, &XQCircularLoadingIndicator::si_Stopped);
+    indicator.Start();
+    QVERIFY(indicator.GetRunning());
+    indicator.Stop();
+
+    // nothing was spawned, so the stop completes synchronously
+    QCOMPARE(stopped.count(), 1);
+    QVERIFY(!indicator.GetRunning());
+    clock.Advance(1000);
+    QCOMPARE(indicator.GetCurrentValue(), 0.0);
+}
+
+void XQCircularLoadingIndicatorAnimationTest::SetCurrentValueOnlyWhenStopped() {
+    XQCircularLoadingIndicatorManualClock clock;
+    XQCircularLoadingIndicator indicator;
+    indicator.SetCurrentValue(90.0);
+    QCOMPARE(indicator.GetCurrentValue(), 90.0);
+
+    QVERIFY(_Start(indicator, clock));
+    indicator.SetCurrentValue(0.0);
+    QCOMPARE(indicator.GetCurrentValue(), 90.0);
+    QVERIFY(_Stop(indicator));
+}
+
+void XQCircularLoadingIndicatorAnimationTest::MoreIndicatorsThanThreadsAnimate() {
+    // all of them are ticked by the clock's one animation thread, none waits
+    // for a free thread of the global pool
+    XQCircularLoadingIndicatorManualClock clock;
+    std::vector<std::unique_ptr<XQCircularLoadingIndicator>> indicators;
+    for (int i = 0; i < QThreadPool::globalInstance()->maxThreadCount() * 2 + 2; i++) {
+        indicators.push_back(std::make_unique<XQCircularLoadingIndicator>());
+        QVERIFY(_Start(*indicators.back(), clock));
+    }
+
+    clock.Advance(100);
+    for (const auto &indicator : indicators) QVERIFY(indicator->GetCurrentValue() > 0);
+
+    for (const auto &indicator : indicators) QVERIFY(_Stop(*indicator));
+}
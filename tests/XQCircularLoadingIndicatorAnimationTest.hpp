@@ -0,0 +1,45 @@
+#ifndef XQCIRCULARLOADINGINDICATORANIMATIONTEST_HPP
+#define XQCIRCULARLOADINGINDICATORANIMATIONTEST_HPP
+
+#include <QObject>
+#include <QSignalSpy>
+#include <QThreadPool>
+#include <QtTest>
+#include <memory>
+#include <vector>
+
+#include "XQCircularLoadingIndicator.hpp"
+
+/**
+ * @brief Phase progression, speed bounds and Start/Stop semantics, driven by
+ * a manual clock so every check is deterministic
+ */
+class XQCircularLoadingIndicatorAnimationTest : public QObject {
+    Q_OBJECT
+
+  private slots:
+    void PhaseFollowsVirtualTime();
+    void SpeedStaysWithinBounds_data();
+    void SpeedStaysWithinBounds();
+    void PhaseDoesNotDependOnSlicing();
+    void StopFreezesPhase();
+    void RestartContinuesPhase();
+    void StopWithinShowDelaySpawnsNothing();
+    void SetCurrentValueOnlyWhenStopped();
+    void MoreIndicatorsThanThreadsAnimate();
+
+  private:
+    /**
+     * @brief Starts the indicator on the clock and waits until its animation
+     * thread is parked, so the next Advance() is the first tick it sees
+     */
+    static bool _Start(xaprier::Qt::Widgets::XQCircularLoadingIndicator &indicator, xaprier::Qt::Widgets::XQCircularLoadingIndicatorManualClock &clock);
+
+    /**
+     * @brief Stops the indicator and waits for si_Stopped, after which the
+     * animation thread no longer uses the clock
+     */
+    static bool _Stop(xaprier::Qt::Widgets::XQCircularLoadingIndicator &indicator);
+};
+
+#endif  // XQCIRCULARLOADINGINDICATORANIMATIONTEST_HPP
@@ -0,0 +1,211 @@
+#include "XQCircularLoadingIndicatorBenchmark.hpp"
+
+using xaprier::Qt::Widgets::XQCircularLoadingIndicator;
+using xaprier::Qt::Widgets::XQCircularLoadingIndicatorPolicy;
+namespace Styles = xaprier::Qt::Widgets::Styles;
+
+using Style = XQCircularLoadingIndicator::Style;
+
+namespace {
+const QList<QPair<Style, QString>> styles = {
+    {Style::Arc, "arc"},
+    {Style::DualArc, "dual-arc"},
+    {Style::Dots, "dots"},
+    {Style::Bars, "bars"},
+};
+
+// the arc of a 256 px indicator with the default look
+Styles::Params Params256(const bool &tail, const bool &texture) {
+    Styles::Params params;
+    params.rect = QRectF(7.5, 7.5, 241, 241);
+    params.penWidth = 13;
+    params.color = QColor("#498BD1");
+    params.bgColor = QColor("#44475a");
+    params.segmentSize = 90;
+    params.tail = tail;
+    params.texture = texture;
+    return params;
+}
+}  // namespace
+
+void XQCircularLoadingIndicatorBenchmark::initTestCase() {
+    // every frame is measured at full quality, the policy would degrade them
+    XQCircularLoadingIndicatorPolicy::Instance()->SetPaintBudget(1e9);
+}
+
+void XQCircularLoadingIndicatorBenchmark::_Settle(XQCircularLoadingIndicator &indicator) {
+    indicator.grab();   // delivers the pending resize, which starts the settle timer
+    QTest::qWait(250);  // longer than the settle interval
+}
+
+void XQCircularLoadingIndicatorBenchmark::PaintFrame_data() {
+    QTest::addColumn<Style>("style");
+    QTest::addColumn<int>("size");
+    QTest::addColumn<bool>("tail");
+    QTest::addColumn<bool>("detail");
+    QTest::addColumn<bool>("text");
+
+    for (const auto &style : styles) {
+        auto tails = style.first == Style::Arc || style.first == Style::DualArc ? QList<bool>{false, true} : QList<bool>{false};
+        for (auto size : {16, 24, 32, 64, 256}) {
+            for (auto tail : tails) {
+                // the level of detail tiers only differ below the small threshold
+                for (auto detail : size < 32 ? QList<bool>{true, false} : QList<bool>{true}) {
+                    auto name = QString("%1-%2%3%4").arg(style.second).arg(size).arg(QString(tail ? "-tail" : "")).arg(QString(detail ? "" : "-full-detail"));
+                    QTest::newRow(qPrintable(name)) << style.first << size << tail << detail << false;
+                }
+            }
+        }
+    }
+    QTest::newRow("arc-64-text") << Style::Arc << 64 << false << true << true;
+    QTest::newRow("arc-256-text") << Style::Arc << 256 << false << true << true;
+}
+
+void XQCircularLoadingIndicatorBenchmark::PaintFrame() {
+    QFETCH(Style, style);
+    QFETCH(int, size);
+    QFETCH(bool, tail);
+    QFETCH(bool, detail);
+    QFETCH(bool, text);
+
+    XQCircularLoadingIndicator indicator;
+    indicator.SetShadow(false);
+    indicator.SetLowDamage(false);
+    indicator.SetStyle(style);
+    indicator.SetTail(tail);
+    indicator.SetEnableText(text);
+    indicator.SetProgressWidth(qMax(2, size / 20));
+    indicator.SetSegmentSize(90);
+    if (!detail) {
+        indicator.SetTinyDetailSize(0);
+        indicator.SetSmallDetailSize(0);
+    }
+    indicator.resize(size, size);
+    _Settle(indicator);
+
+    QImage target(indicator.size(), QImage::Format_ARGB32_Premultiplied);
+    double phase = 0;
+    QBENCHMARK {
+        indicator.SetCurrentValue(phase += 7);
+        indicator.render(&target);
+    }
+}
+
+template <typename S>
+void XQCircularLoadingIndicatorBenchmark::_DrawStyle(const Styles::Params &params, const bool &texture) {
+    typename S::Geometry geometry;
+    S::Prepare(geometry, params);
+    if (texture) S::PrepareTexture(geometry, params);
+
+    QImage target(256, 256, QImage::Format_ARGB32_Premultiplied);
+    target.fill(::Qt::transparent);
+    QPainter painter(&target);
+    painter.setRenderHint(QPainter::Antialiasing);
+    double phase = 0;
+    QBENCHMARK {
+        phase += 7;
+        S::Draw(painter, geometry, -phase, params.segmentSize, true);
+    }
+}
+
+void XQCircularLoadingIndicatorBenchmark::DrawStyle_data() {
+    QTest::addColumn<Style>("style");
+    QTest::addColumn<bool>("tail");
+    QTest::addColumn<bool>("texture");
+
+    // arc-tail-* against arc is the tail's cost, see TailCostFactor
+    for (const auto &style : styles) QTest::newRow(qPrintable(style.second)) << style.first << false << false;
+    QTest::newRow("arc-tail-gradient") << Style::Arc << true << false;
+    QTest::newRow("arc-tail-texture") << Style::Arc << true << true;
+    QTest::newRow("dual-arc-tail-gradient") << Style::DualArc << true << false;
+    QTest::newRow("dual-arc-tail-texture") << Style::DualArc << true << true;
+}
+
+void XQCircularLoadingIndicatorBenchmark::DrawStyle() {
+    QFETCH(Style, style);
+    QFETCH(bool, tail);
+    QFETCH(bool, texture);
+
+    auto params = Params256(tail, texture);
+
+    switch (style) {
+        case Style::Arc:
+            _DrawStyle<Styles::Arc>(params, texture);
+            break;
+        case Style::DualArc:
+            _DrawStyle<Styles::DualArc>(params, texture);
+            break;
+        case Style::Dots:
+            _DrawStyle<Styles::Dots>(params, texture);
+            break;
+        case Style::Bars:
+            _DrawStyle<Styles::Bars>(params, texture);
+            break;
+    }
+}
+
+qint64 XQCircularLoadingIndicatorBenchmark::_TimeArc(const Styles::Params &params) {
+    Styles::Arc::Geometry geometry;
+    Styles::Arc::Prepare(geometry, params);
+    Styles::Arc::PrepareTexture(geometry, params);
+
+    QImage target(256, 256, QImage::Format_ARGB32_Premultiplied);
+    target.fill(::Qt::transparent);
+    QPainter painter(&target);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    // the fastest run is the one least disturbed by the rest of the machine
+    auto best = std::numeric_limits<qint64>::max();
+    for (int run = 0; run < 5; run++) {
+        QElapsedTimer timer;
+        timer.start();
+        for (int frame = 0; frame < 200; frame++) Styles::Arc::Draw(painter, geometry, -frame * 7.0, params.segmentSize, true);
+        best = qMin(best, timer.nsecsElapsed());
+    }
+    return best;
+}
+
+void XQCircularLoadingIndicatorBenchmark::TailCost() {
+    auto solid = qMax<qint64>(1, _TimeArc(Params256(false, false)));
+    auto texture = static_cast<double>(_TimeArc(Params256(true, true))) / solid;
+    auto gradient = static_cast<double>(_TimeArc(Params256(true, false))) / solid;
+    qInfo().noquote() << QString("tail at 256 px: texture %1x, gradient %2x the solid arc").arg(texture, 0, 'f', 2).arg(gradient, 0, 'f', 2);
+
+    // only the texture path is promised, the gradient is the non-raster fallback
+    QVERIFY2(texture <= TailCostFactor, qPrintable(QString("texture tail costs %1x the solid arc, more than %2x").arg(texture, 0, 'f', 2).arg(TailCostFactor)));
+}
+
+void XQCircularLoadingIndicatorBenchmark::DrawLabel_data() {
+    QTest::addColumn<bool>("staticText");
+    QTest::addColumn<QString>("text");
+
+    // drawText() is how every frame laid the label out before QStaticText
+    QTest::newRow("draw-text") << false << QString("Loading...");
+    QTest::newRow("static-text") << true << QString("Loading...");
+    QTest::newRow("draw-text-long") << false << QString("Fetching the remote repository index");
+    QTest::newRow("static-text-long") << true << QString("Fetching the remote repository index");
+}
+
+void XQCircularLoadingIndicatorBenchmark::DrawLabel() {
+    QFETCH(bool, staticText);
+    QFETCH(QString, text);
+
+    QImage target(200, 200, QImage::Format_ARGB32_Premultiplied);
+    target.fill(::Qt::transparent);
+    QPainter painter(&target);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(QColor("#498BD1"));
+
+    if (staticText) {
+        QStaticText label(text);
+        label.setTextFormat(::Qt::PlainText);
+        label.setPerformanceHint(QStaticText::AggressiveCaching);
+        label.prepare(QTransform(), painter.font());
+        auto position = QPointF(100 - label.size().width() / 2, 100 - label.size().height() / 2);
+        QBENCHMARK { painter.drawStaticText(position, label); }
+    } else {
+        QBENCHMARK { painter.drawText(target.rect(), ::Qt::AlignCenter, text); }
+    }
+}
+
+QTEST_MAIN(XQCircularLoadingIndicatorBenchmark)
@@ -0,0 +1,63 @@
+#ifndef XQCIRCULARLOADINGINDICATORBENCHMARK_HPP
+#define XQCIRCULARLOADINGINDICATORBENCHMARK_HPP
+
+#include <QElapsedTimer>
+#include <QImage>
+#include <QObject>
+#include <QPainter>
+#include <QStaticText>
+#include <QtTest>
+#include <limits>
+
+#include "XQCircularLoadingIndicator.hpp"
+#include "XQCircularLoadingIndicatorStyles.hpp"
+
+/**
+ * @brief Per-frame paint cost, run with the options of QTest (e.g.
+ * -tickcounter, -callgrind):
+ *  - PaintFrame: the widget over style, size, tail and level of detail, with
+ *    and without the label
+ *  - DrawStyle: one style primitive at 256 px, solid against the tail's
+ *    gradient and texture paths
+ *  - TailCost: checks the tail against the solid arc at 256 px, see
+ *    TailCostFactor
+ *  - DrawLabel: the label through QPainter::drawText against QStaticText
+ */
+class XQCircularLoadingIndicatorBenchmark : public QObject {
+    Q_OBJECT
+
+  public:
+    /**
+     * @brief Stated paint cost of the arc's tail on the raster engine (the
+     * texture path) relative to the solid arc, both at 256 px
+     */
+    static constexpr double TailCostFactor = 2.0;
+
+  private slots:
+    void initTestCase();
+
+    void PaintFrame_data();
+    void PaintFrame();
+    void DrawStyle_data();
+    void DrawStyle();
+    void TailCost();
+    void DrawLabel_data();
+    void DrawLabel();
+
+  private:
+    /**
+     * @brief Waits until the caches are built for the current size, frames
+     * painted during the resize settle take the stretched layer
+     */
+    static void _Settle(xaprier::Qt::Widgets::XQCircularLoadingIndicator &indicator);
+
+    template <typename S>
+    static void _DrawStyle(const xaprier::Qt::Widgets::Styles::Params &params, const bool &texture);
+
+    /**
+     * @brief Best of a few timed runs of the arc's Draw(), in nanoseconds
+     */
+    static qint64 _TimeArc(const xaprier::Qt::Widgets::Styles::Params &params);
+};
+
+#endif  // XQCIRCULARLOADINGINDICATORBENCHMARK_HPP
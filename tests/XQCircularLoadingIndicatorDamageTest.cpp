@@ -0,0 +1,65 @@
+#include "XQCircularLoadingIndicatorDamageTest.hpp"
+
+using xaprier::Qt::Widgets::XQCircularLoadingIndicator;
+using xaprier::Qt::Widgets::XQCircularLoadingIndicatorManualClock;
+using xaprier::Qt::Widgets::XQCircularLoadingIndicatorPolicy;
+
+qint64 XQCircularLoadingIndicatorDamageTest::_DamagePerSecond(const XQCircularLoadingIndicator::Style &style, const int &size, const bool &threaded,
+                                                              const bool &lowDamage) {
+    XQCircularLoadingIndicatorManualClock clock;
+    XQCircularLoadingIndicator indicator;
+    indicator.SetShadow(false);
+    indicator.SetStyle(style);
+    indicator.SetThreadedRendering(threaded);
+    indicator.SetLowDamage(lowDamage);
+    indicator.SetClock(&clock);
+    indicator.resize(size, size);
+    indicator.show();
+    if (!QTest::qWaitForWindowExposed(&indicator)) return -1;
+    QTest::qWait(250);  // caches settled, threaded rendering only starts then
+
+    indicator.Start();
+    clock.Advance(0);  // returns once the thread is parked on its first sleep
+    QCoreApplication::processEvents();
+    auto before = indicator.GetDamagedBytes();
+
+    // base ticks, the queued repaints run between them as they would live
+    for (qint64 elapsed = 0; elapsed < 1000; elapsed += XQCircularLoadingIndicatorPolicy::BaseTickInterval) {
+        clock.Advance(XQCircularLoadingIndicatorPolicy::BaseTickInterval);
+        QCoreApplication::processEvents();
+    }
+    auto damaged = indicator.GetDamagedBytes() - before;
+
+    QSignalSpy stopped(&indicator, &XQCircularLoadingIndicator::si_Stopped);
+    indicator.Stop();
+    if (stopped.count() == 0 && !stopped.wait(5000)) return -1;
+    return damaged;
+}
+
+void XQCircularLoadingIndicatorDamageTest::LowDamageRepaintsLess_data() {
+    QTest::addColumn<XQCircularLoadingIndicator::Style>("style");
+    QTest::addColumn<int>("size");
+    QTest::addColumn<bool>("threaded");
+
+    QTest::newRow("arc-200") << XQCircularLoadingIndicator::Style::Arc << 200 << false;
+    QTest::newRow("arc-64") << XQCircularLoadingIndicator::Style::Arc << 64 << false;
+    QTest::newRow("dual-arc-200") << XQCircularLoadingIndicator::Style::DualArc << 200 << false;
+    QTest::newRow("dots-200") << XQCircularLoadingIndicator::Style::Dots << 200 << false;
+    QTest::newRow("bars-200") << XQCircularLoadingIndicator::Style::Bars << 200 << false;
+    QTest::newRow("arc-200-threaded") << XQCircularLoadingIndicator::Style::Arc << 200 << true;
+}
+
+void XQCircularLoadingIndicatorDamageTest::LowDamageRepaintsLess() {
+    QFETCH(XQCircularLoadingIndicator::Style, style);
+    QFETCH(int, size);
+    QFETCH(bool, threaded);
+
+    auto full = _DamagePerSecond(style, size, threaded, false);
+    auto low = _DamagePerSecond(style, size, threaded, true);
+    QVERIFY(full > 0);
+    QVERIFY(low >= 0);
+    qInfo("%s: %lld bytes/s by default, %lld bytes/s in low-damage mode (%.1f%%)", QTest::currentDataTag(), full, low, 100.0 * low / full);
+
+    // fewer ticks, and each repaints the old and new segment only
+    QVERIFY2(low * 2 < full, qPrintable(QString("low-damage %1 bytes/s, default %2 bytes/s").arg(low).arg(full)));
+}
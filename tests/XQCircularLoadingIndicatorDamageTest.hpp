@@ -0,0 +1,30 @@
+#ifndef XQCIRCULARLOADINGINDICATORDAMAGETEST_HPP
+#define XQCIRCULARLOADINGINDICATORDAMAGETEST_HPP
+
+#include <QObject>
+#include <QSignalSpy>
+#include <QtTest>
+
+#include "XQCircularLoadingIndicator.hpp"
+
+/**
+ * @brief Damaged bytes per second of the low-damage mode against the default
+ * mode, over one second of manual clock time on a shown widget
+ */
+class XQCircularLoadingIndicatorDamageTest : public QObject {
+    Q_OBJECT
+
+  private slots:
+    void LowDamageRepaintsLess_data();
+    void LowDamageRepaintsLess();
+
+  private:
+    /**
+     * @brief Runs a shown indicator for one second of virtual time and returns
+     * the bytes it repainted, the paints from showing it excluded
+     */
+    static qint64 _DamagePerSecond(const xaprier::Qt::Widgets::XQCircularLoadingIndicator::Style &style, const int &size, const bool &threaded,
+                                   const bool &lowDamage);
+};
+
+#endif  // XQCIRCULARLOADINGINDICATORDAMAGETEST_HPP
@@ -0,0 +1,102 @@
+#include "XQCircularLoadingIndicatorGoldenTest.hpp"
+
+using xaprier::Qt::Widgets::XQCircularLoadingIndicator;
+
+QImage XQCircularLoadingIndicatorGoldenTest::_Grab(XQCircularLoadingIndicator &indicator) {
+    indicator.grab();    // delivers the pending resize, which starts the settle timer
+    QTest::qWait(250);   // longer than the settle interval
+    return indicator.grab().toImage().convertToFormat(QImage::Format_ARGB32);
+}
+
+double XQCircularLoadingIndicatorGoldenTest::_Difference(const QImage &actual, const QImage &expected) {
+    if (actual.size() != expected.size()) return 1.0;
+
+    qint64 differing = 0;
+    for (int y = 0; y < actual.height(); y++) {
+        auto *a = reinterpret_cast<const QRgb *>(actual.constScanLine(y));
+        auto *e = reinterpret_cast<const QRgb *>(expected.constScanLine(y));
+        for (int x = 0; x < actual.width(); x++) {
+            auto distance = qMax(qMax(qAbs(qRed(a[x]) - qRed(e[x])), qAbs(qGreen(a[x]) - qGreen(e[x]))),
+                                 qMax(qAbs(qBlue(a[x]) - qBlue(e[x])), qAbs(qAlpha(a[x]) - qAlpha(e[x]))));
+            if (distance > ChannelTolerance) differing++;
+        }
+    }
+    return static_cast<double>(differing) / (static_cast<qint64>(actual.width()) * actual.height());
+}
+
+void XQCircularLoadingIndicatorGoldenTest::MatchesGolden_data() {
+    QTest::addColumn<QSize>("size");
+    QTest::addColumn<int>("progressWidth");
+    QTest::addColumn<int>("segmentSize");
+    QTest::addColumn<bool>("roundedCap");
+    QTest::addColumn<bool>("background");
+    QTest::addColumn<bool>("text");
+    QTest::addColumn<int>("alignment");
+    QTest::addColumn<bool>("square");
+    QTest::addColumn<double>("phase");
+
+    const int center = ::Qt::AlignCenter;
+    const int topLeft = ::Qt::AlignTop | ::Qt::AlignLeft;
+    const int bottomRight = ::Qt::AlignBottom | ::Qt::AlignRight;
+
+    // size, pen, segment, cap, background, text, alignment, square, phase
+    QTest::newRow("default") << QSize(200, 200) << 10 << 12 << true << true << false << center << false << 0.0;
+    QTest::newRow("default-phase") << QSize(200, 200) << 10 << 12 << true << true << false << center << false << 137.0;
+    QTest::newRow("no-background") << QSize(200, 200) << 10 << 12 << true << false << false << center << false << 45.0;
+    QTest::newRow("flat-cap") << QSize(200, 200) << 10 << 12 << false << true << false << center << false << 45.0;
+    QTest::newRow("long-segment") << QSize(200, 200) << 10 << 270 << true << true << false << center << false << 90.0;
+    QTest::newRow("thick") << QSize(200, 200) << 30 << 90 << true << true << false << center << false << 200.0;
+    QTest::newRow("hairline") << QSize(200, 200) << 1 << 90 << false << true << false << center << false << 300.0;
+    QTest::newRow("text") << QSize(200, 200) << 10 << 90 << true << true << true << center << false << 45.0;
+    QTest::newRow("text-elided") << QSize(64, 64) << 6 << 90 << true << true << true << center << false << 45.0;
+    QTest::newRow("small") << QSize(24, 24) << 3 << 90 << true << true << false << center << false << 60.0;
+    QTest::newRow("tiny") << QSize(16, 16) << 2 << 90 << true << true << false << center << false << 60.0;
+    QTest::newRow("stretched") << QSize(300, 150) << 10 << 90 << true << true << false << center << false << 45.0;
+    QTest::newRow("square-center") << QSize(300, 150) << 10 << 90 << true << true << false << center << true << 45.0;
+    QTest::newRow("square-top-left") << QSize(300, 150) << 10 << 90 << true << true << false << topLeft << true << 45.0;
+    QTest::newRow("square-bottom-right") << QSize(150, 300) << 10 << 90 << true << true << true << bottomRight << true << 45.0;
+}
+
+void XQCircularLoadingIndicatorGoldenTest::MatchesGolden() {
+    QFETCH(QSize, size);
+    QFETCH(int, progressWidth);
+    QFETCH(int, segmentSize);
+    QFETCH(bool, roundedCap);
+    QFETCH(bool, background);
+    QFETCH(bool, text);
+    QFETCH(int, alignment);
+    QFETCH(bool, square);
+    QFETCH(double, phase);
+
+    XQCircularLoadingIndicator indicator;
+    indicator.SetShadow(false);      // the effect isn't part of the widget's own rendering
+    indicator.SetLowDamage(false);   // no phase quantization
+    indicator.SetProgressAlignment(::Qt::Alignment(QFlag(alignment)));
+    indicator.SetSquare(square);
+    indicator.SetProgressWidth(progressWidth);
+    indicator.SetSegmentSize(segmentSize);
+    indicator.SetProgressRoundedCap(roundedCap);
+    indicator.SetEnableBg(background);
+    indicator.SetEnableText(text);
+    indicator.SetCurrentValue(phase);
+    indicator.resize(size);
+
+    auto actual = _Grab(indicator);
+    QVERIFY(!actual.isNull());
+
+    QDir directory(XQ_INDICATOR_GOLDEN_DIR);
+    auto path = directory.filePath(QString("%1.png").arg(QTest::currentDataTag()));
+    if (qEnvironmentVariableIntValue("XQ_INDICATOR_UPDATE_GOLDENS") != 0) {
+        QVERIFY(directory.mkpath("."));
+        QVERIFY(actual.save(path));
+        QSKIP("golden written");
+    }
+
+    QImage expected(path);
+    if (expected.isNull()) QFAIL(qPrintable(QString("no golden at %1, record it with XQ_INDICATOR_UPDATE_GOLDENS=1").arg(path)));
+
+    auto difference = _Difference(actual, expected.convertToFormat(QImage::Format_ARGB32));
+    auto tolerance = text ? TextPixelTolerance : PixelTolerance;
+    if (difference > tolerance) actual.save(QDir(QDir::tempPath()).filePath(QString("XQCircularLoadingIndicator-%1.png").arg(QTest::currentDataTag())));
+    QVERIFY2(difference <= tolerance, qPrintable(QString("%1 of the pixels differ, actual image written to the temporary directory").arg(difference)));
+}
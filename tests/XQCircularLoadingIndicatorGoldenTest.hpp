@@ -0,0 +1,41 @@
+#ifndef XQCIRCULARLOADINGINDICATORGOLDENTEST_HPP
+#define XQCIRCULARLOADINGINDICATORGOLDENTEST_HPP
+
+#include <QDir>
+#include <QImage>
+#include <QObject>
+#include <QtTest>
+
+#include "XQCircularLoadingIndicator.hpp"
+
+/**
+ * @brief Renders fixed phases with grab() over a matrix of the visual
+ * properties and compares them against the images in tests/golden. Rows
+ * without a golden fail; XQ_INDICATOR_UPDATE_GOLDENS=1 (re)writes them.
+ */
+class XQCircularLoadingIndicatorGoldenTest : public QObject {
+    Q_OBJECT
+
+  private slots:
+    void MatchesGolden_data();
+    void MatchesGolden();
+
+  private:
+    static constexpr int ChannelTolerance = 24;         //> per channel, absorbs antialiasing differences between Qt versions
+    static constexpr double PixelTolerance = 0.005;     //> fraction of pixels allowed past the channel tolerance
+    static constexpr double TextPixelTolerance = 0.03;  //> glyphs depend on the fonts installed
+
+    /**
+     * @brief Grabs the indicator once its caches are built for the current
+     * size, a grab during the resize settle would show the stretched layer
+     */
+    static QImage _Grab(xaprier::Qt::Widgets::XQCircularLoadingIndicator &indicator);
+
+    /**
+     * @brief Fraction of pixels differing by more than the channel tolerance,
+     * 1 when the sizes differ
+     */
+    static double _Difference(const QImage &actual, const QImage &expected);
+};
+
+#endif  // XQCIRCULARLOADINGINDICATORGOLDENTEST_HPP
@@ -0,0 +1,76 @@
+#include "XQCircularLoadingIndicatorLifetimeTest.hpp"
+
+using xaprier::Qt::Widgets::XQCircularLoadingIndicator;
+using xaprier::Qt::Widgets::XQCircularLoadingIndicatorManualClock;
+
+int XQCircularLoadingIndicatorLifetimeTest::_Iterations() {
+    bool ok = false;
+    auto iterations = qEnvironmentVariableIntValue("XQ_INDICATOR_STRESS_ITERATIONS", &ok);
+    return ok && iterations > 0 ? iterations : 100000;
+}
+
+void XQCircularLoadingIndicatorLifetimeTest::ManualClockOutlivesStop() {
+    // the README example: the thread still holds the clock when Stop() returns
+    XQCircularLoadingIndicator indicator;
+    {
+        XQCircularLoadingIndicatorManualClock clock;
+        indicator.SetClock(&clock);
+        indicator.Start();
+        clock.Advance(250);
+        indicator.Stop();
+        indicator.SetClock(nullptr);
+    }  // waits for the thread to detach
+    QVERIFY(!indicator.GetRunning());
+}
+
+void XQCircularLoadingIndicatorLifetimeTest::CreateDestroyStress() {
+    auto iterations = _Iterations();
+    auto cacheBytes = XQCircularLoadingIndicator::GetTotalCacheBytes();
+
+    for (int i = 0; i < iterations; i++) {
+        switch (i % 4) {
+            case 0: {
+                // destroyed while running on the system clock
+                auto *indicator = new XQCircularLoadingIndicator();
+                indicator->Start();
+                delete indicator;
+                break;
+            }
+            case 1: {
+                // stopped, then destroyed before the thread has exited
+                auto *indicator = new XQCircularLoadingIndicator();
+                indicator->Start();
+                indicator->Stop();
+                delete indicator;
+                break;
+            }
+            case 2: {
+                // stopped, clock destroyed before the indicator
+                XQCircularLoadingIndicator indicator;
+                XQCircularLoadingIndicatorManualClock clock;
+                indicator.SetClock(&clock);
+                indicator.Start();
+                clock.Advance(10);
+                indicator.Stop();
+                indicator.SetClock(nullptr);
+                break;
+            }
+            case 3: {
+                // destroyed while running, clock destroyed after the indicator
+                XQCircularLoadingIndicatorManualClock clock;
+                auto *indicator = new XQCircularLoadingIndicator();
+                indicator->SetClock(&clock);
+                indicator->Start();
+                clock.Advance(10);
+                delete indicator;
+                break;
+            }
+        }
+
+        // queued repaints and si_Stopped of destroyed indicators must be dropped
+        if (i % 1000 == 999) QCoreApplication::processEvents();
+    }
+    QCoreApplication::processEvents();
+
+    QCOMPARE(XQCircularLoadingIndicator::GetTotalCacheBytes(), cacheBytes);
+}
@@ -0,0 +1,26 @@
+#ifndef XQCIRCULARLOADINGINDICATORLIFETIMETEST_HPP
+#define XQCIRCULARLOADINGINDICATORLIFETIMETEST_HPP
+
+#include <QObject>
+#include <QtTest>
+
+#include "XQCircularLoadingIndicator.hpp"
+
+/**
+ * @brief Creates and destroys indicators while their animation threads run.
+ * Meant to be run under -DXQ_INDICATOR_SANITIZER=address or thread; the
+ * iteration count defaults to 100000 and can be lowered with
+ * XQ_INDICATOR_STRESS_ITERATIONS.
+ */
+class XQCircularLoadingIndicatorLifetimeTest : public QObject {
+    Q_OBJECT
+
+  private slots:
+    void ManualClockOutlivesStop();
+    void CreateDestroyStress();
+
+  private:
+    static int _Iterations();
+};
+
+#endif  // XQCIRCULARLOADINGINDICATORLIFETIMETEST_HPP
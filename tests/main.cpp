@@ -0,0 +1,32 @@
+#include <QApplication>
+#include <QtTest>
+
+#include "XQCircularLoadingIndicatorAnimationTest.hpp"
+#include "XQCircularLoadingIndicatorDamageTest.hpp"
+#include "XQCircularLoadingIndicatorGoldenTest.hpp"
+#include "XQCircularLoadingIndicatorLifetimeTest.hpp"
+
+int main(int argc, char *argv[]) {
+    // headless by default, ctest sets the same
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) qputenv("QT_QPA_PLATFORM", "offscreen");
+    QApplication app(argc, argv);
+
+    int status = 0;
+    {
+        XQCircularLoadingIndicatorAnimationTest test;
+        status |= QTest::qExec(&test, argc, argv);
+    }
+    {
+        XQCircularLoadingIndicatorLifetimeTest test;
+        status |= QTest::qExec(&test, argc, argv);
+    }
+    {
+        XQCircularLoadingIndicatorGoldenTest test;
+        status |= QTest::qExec(&test, argc, argv);
+    }
+    {
+        XQCircularLoadingIndicatorDamageTest test;
+        status |= QTest::qExec(&test, argc, argv);
+    }
+    return status;
+}